@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// measures per element cost of pointer extensions, compared to plain values.
+// pointer extensions look up their contexts for every element, context lookup
+// is resolved at compile time, so "values with context lookup" should be close
+// to "values" (the extra cost is incrementing the context itself), and the
+// difference for pointers comes from pointer linking and allocation.
+//
+// build with -DBITSERY_BUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+
+#include <bitsery/adapter/buffer.h>
+#include <bitsery/bitsery.h>
+#include <bitsery/ext/pointer.h>
+#include <bitsery/ext/std_smart_ptr.h>
+#include <bitsery/traits/vector.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using Buffer = std::vector<uint8_t>;
+using Context = std::tuple<int, bitsery::ext::PointerLinkingContext>;
+using Writer = bitsery::OutputBufferAdapter<Buffer>;
+using Reader = bitsery::InputBufferAdapter<Buffer>;
+using Serializer = bitsery::Serializer<Writer, Context>;
+using Deserializer = bitsery::Deserializer<Reader, Context>;
+
+constexpr size_t ElementsCount = 1000000;
+constexpr int Repeats = 20;
+
+struct Values
+{
+  std::vector<uint32_t> data{};
+};
+
+struct ValuesPerElement
+{
+  std::vector<uint32_t> data{};
+};
+
+struct ValuesWithContextLookup
+{
+  std::vector<uint32_t> data{};
+};
+
+struct RawPointers
+{
+  std::vector<uint32_t*> data{};
+  RawPointers() = default;
+  RawPointers(const RawPointers&) = delete;
+  RawPointers& operator=(const RawPointers&) = delete;
+  ~RawPointers()
+  {
+    for (auto p : data)
+      delete p;
+  }
+};
+
+struct UniquePointers
+{
+  std::vector<std::unique_ptr<uint32_t>> data{};
+};
+
+template<typename S>
+void
+serialize(S& s, Values& o)
+{
+  s.container4b(o.data, ElementsCount);
+}
+
+template<typename S>
+void
+serialize(S& s, ValuesPerElement& o)
+{
+  s.container(
+    o.data, ElementsCount, [](S& s, uint32_t& v) { s.value4b(v); });
+}
+
+template<typename S>
+void
+serialize(S& s, ValuesWithContextLookup& o)
+{
+  s.container(o.data, ElementsCount, [](S& s, uint32_t& v) {
+    // same lookup that extensions do, for every element
+    s.template context<int>() += 1;
+    s.value4b(v);
+  });
+}
+
+template<typename S>
+void
+serialize(S& s, RawPointers& o)
+{
+  s.container(o.data, ElementsCount, [](S& s, uint32_t*& v) {
+    s.ext4b(v, bitsery::ext::PointerOwner{});
+  });
+}
+
+template<typename S>
+void
+serialize(S& s, UniquePointers& o)
+{
+  s.container(o.data, ElementsCount, [](S& s, std::unique_ptr<uint32_t>& v) {
+    s.ext4b(v, bitsery::ext::StdSmartPtr{});
+  });
+}
+
+uint32_t
+checksum(const Values& o)
+{
+  uint32_t res{};
+  for (auto v : o.data)
+    res += v;
+  return res;
+}
+
+uint32_t
+checksum(const ValuesPerElement& o)
+{
+  uint32_t res{};
+  for (auto v : o.data)
+    res += v;
+  return res;
+}
+
+uint32_t
+checksum(const ValuesWithContextLookup& o)
+{
+  uint32_t res{};
+  for (auto v : o.data)
+    res += v;
+  return res;
+}
+
+uint32_t
+checksum(const RawPointers& o)
+{
+  uint32_t res{};
+  for (auto v : o.data)
+    res += *v;
+  return res;
+}
+
+uint32_t
+checksum(const UniquePointers& o)
+{
+  uint32_t res{};
+  for (auto& v : o.data)
+    res += *v;
+  return res;
+}
+
+template<typename T>
+void
+run(const char* name, const T& data)
+{
+  using Clock = std::chrono::steady_clock;
+  Buffer buffer{};
+  size_t writtenSize{};
+  Clock::duration serTime{};
+  Clock::duration desTime{};
+  uint32_t sum{};
+  for (auto i = 0; i < Repeats; ++i) {
+    Context serCtx{};
+    auto start = Clock::now();
+    Serializer ser{ serCtx, buffer };
+    ser.object(data);
+    ser.adapter().flush();
+    writtenSize = ser.adapter().writtenBytesCount();
+    serTime += Clock::now() - start;
+
+    Context desCtx{};
+    T res{};
+    start = Clock::now();
+    Deserializer des{ desCtx, buffer.begin(), writtenSize };
+    des.object(res);
+    desTime += Clock::now() - start;
+    if (des.adapter().error() != bitsery::ReaderError::NoError) {
+      std::printf("%s: deserialization failed\n", name);
+      return;
+    }
+    sum += checksum(res);
+  }
+  const auto perElement = [](Clock::duration d) {
+    return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) /
+           (static_cast<double>(ElementsCount) * Repeats);
+  };
+  std::printf("%-28s ser %6.2f ns/elem  des %6.2f ns/elem  %8zu bytes  (%u)\n",
+              name,
+              perElement(serTime),
+              perElement(desTime),
+              writtenSize,
+              sum);
+}
+
+int
+main()
+{
+  Values values{};
+  ValuesPerElement valuesPerElement{};
+  ValuesWithContextLookup valuesCtx{};
+  RawPointers rawPointers{};
+  UniquePointers uniquePointers{};
+  for (size_t i = 0; i < ElementsCount; ++i) {
+    const auto v = static_cast<uint32_t>(i * 7);
+    values.data.push_back(v);
+    valuesPerElement.data.push_back(v);
+    valuesCtx.data.push_back(v);
+    rawPointers.data.push_back(new uint32_t{ v });
+    uniquePointers.data.emplace_back(new uint32_t{ v });
+  }
+  run("values (bulk)", values);
+  run("values", valuesPerElement);
+  run("values with context lookup", valuesCtx);
+  run("PointerOwner", rawPointers);
+  run("StdSmartPtr (unique_ptr)", uniquePointers);
+}
@@ -0,0 +1,345 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_ADAPTER_ASYNC_FD_H
+#define BITSERY_ADAPTER_ASYNC_FD_H
+
+#if __cplusplus < 202002L
+#error async fd adapters require c++20 (coroutines)
+#endif
+
+#include "../traits/core/traits.h"
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace bitsery {
+
+/*
+ * coroutine helpers to send and receive serialized data over non-blocking file
+ * descriptors (sockets, pipes), so that many connections can share few threads.
+ * serialize/deserialize functions are synchronous, so data is (de)serialized
+ * with buffer adapters, and only transfer of the buffer is asynchronous: when
+ * fd is not ready, coroutine suspends and is resumed by reactor (e.g. epoll
+ * loop) when fd becomes ready.
+ * there is no adapter that suspends when its buffer is full or empty in the
+ * middle of (de)serialization: stackless coroutines cannot suspend from
+ * synchronous serialize functions, so whole message is buffered.
+ *
+ * Reactor is user provided type with these functions:
+ *   void waitReadable(int fd, std::coroutine_handle<> h);
+ *   void waitWritable(int fd, std::coroutine_handle<> h);
+ * it must resume `h` once, when `fd` becomes readable/writable.
+ *
+ * sockets are written with MSG_NOSIGNAL (if available), so closed peer is
+ * reported as error. for pipes, or on platforms without MSG_NOSIGNAL, process
+ * must ignore SIGPIPE, otherwise writing to closed peer terminates it.
+ */
+
+// lazily started coroutine, that returns value of type T.
+// it can be awaited from another coroutine, or started via `start`.
+template<typename T>
+class AsyncTask
+{
+public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  // resumes awaiting coroutine, if any, when task completes
+  struct FinalAwaiter
+  {
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(Handle h) noexcept
+    {
+      auto continuation = h.promise().continuation;
+      if (continuation)
+        return continuation;
+      return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  struct promise_type
+  {
+    T value{};
+    std::coroutine_handle<> continuation{};
+
+    AsyncTask get_return_object()
+    {
+      return AsyncTask{ Handle::from_promise(*this) };
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void return_value(T v) { value = std::move(v); }
+
+    // library doesn't use exceptions
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+
+  AsyncTask(const AsyncTask&) = delete;
+  AsyncTask& operator=(const AsyncTask&) = delete;
+
+  AsyncTask(AsyncTask&& other) noexcept
+    : _handle{ std::exchange(other._handle, {}) }
+  {
+  }
+
+  AsyncTask& operator=(AsyncTask&& other) noexcept
+  {
+    if (this != &other) {
+      destroy();
+      _handle = std::exchange(other._handle, {});
+    }
+    return *this;
+  }
+
+  ~AsyncTask() { destroy(); }
+
+  bool await_ready() const noexcept { return _handle.done(); }
+
+  std::coroutine_handle<> await_suspend(
+    std::coroutine_handle<> continuation) noexcept
+  {
+    _handle.promise().continuation = continuation;
+    return _handle;
+  }
+
+  T await_resume() { return std::move(_handle.promise().value); }
+
+  // start task that is not awaited by other coroutine,
+  // it runs until first suspension point
+  void start() { _handle.resume(); }
+
+  bool done() const { return _handle.done(); }
+
+  // result of completed task
+  const T& result() const { return _handle.promise().value; }
+
+private:
+  explicit AsyncTask(Handle handle)
+    : _handle{ handle }
+  {
+  }
+
+  void destroy()
+  {
+    if (_handle)
+      _handle.destroy();
+  }
+
+  Handle _handle;
+};
+
+enum class FdEvent
+{
+  Readable,
+  Writable
+};
+
+// suspends coroutine until reactor reports that fd is ready
+template<typename Reactor>
+struct FdReadyAwaitable
+{
+  Reactor& reactor;
+  int fd;
+  FdEvent event;
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> h)
+  {
+    if (event == FdEvent::Readable)
+      reactor.waitReadable(fd, h);
+    else
+      reactor.waitWritable(fd, h);
+  }
+
+  void await_resume() const noexcept {}
+};
+
+namespace details {
+
+inline bool
+isWouldBlock(int err)
+{
+  return err == EAGAIN || err == EWOULDBLOCK;
+}
+
+template<typename Buffer>
+auto
+asyncBufferData(Buffer& buffer)
+{
+  static_assert(traits::ContainerTraits<
+                  typename std::remove_const<Buffer>::type>::isContiguous,
+                "buffer must be contiguous container");
+  static_assert(sizeof(*std::begin(buffer)) == 1,
+                "buffer underlying type must be 1byte.");
+  return std::addressof(*std::begin(buffer));
+}
+
+// writes to socket without raising SIGPIPE, falls back to `write` when fd is
+// not a socket
+inline ssize_t
+writeSome(int fd, const void* data, size_t size, bool& isSocket)
+{
+#ifdef MSG_NOSIGNAL
+  if (isSocket) {
+    const auto n = ::send(fd, data, size, MSG_NOSIGNAL);
+    if (n >= 0 || errno != ENOTSOCK)
+      return n;
+    isSocket = false;
+  }
+#else
+  isSocket = false;
+#endif
+  return ::write(fd, data, size);
+}
+
+}
+
+/*
+ * writes all `size` bytes to non-blocking fd, suspends while fd is not
+ * writable. returns false on error.
+ */
+template<typename Reactor>
+AsyncTask<bool>
+asyncWriteAll(Reactor& reactor, int fd, const void* data, size_t size)
+{
+  auto it = static_cast<const uint8_t*>(data);
+  bool isSocket = true;
+  while (size > 0) {
+    const auto n = details::writeSome(fd, it, size, isSocket);
+    if (n > 0) {
+      it += n;
+      size -= static_cast<size_t>(n);
+    } else if (n < 0 && details::isWouldBlock(errno)) {
+      co_await FdReadyAwaitable<Reactor>{ reactor, fd, FdEvent::Writable };
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else {
+      co_return false;
+    }
+  }
+  co_return true;
+}
+
+/*
+ * reads exactly `size` bytes from non-blocking fd, suspends while fd is not
+ * readable. returns false on error or end of stream.
+ */
+template<typename Reactor>
+AsyncTask<bool>
+asyncReadAll(Reactor& reactor, int fd, void* data, size_t size)
+{
+  auto it = static_cast<uint8_t*>(data);
+  while (size > 0) {
+    const auto n = ::read(fd, it, size);
+    if (n > 0) {
+      it += n;
+      size -= static_cast<size_t>(n);
+    } else if (n < 0 && details::isWouldBlock(errno)) {
+      co_await FdReadyAwaitable<Reactor>{ reactor, fd, FdEvent::Readable };
+    } else if (n < 0 && errno == EINTR) {
+      continue;
+    } else {
+      co_return false;
+    }
+  }
+  co_return true;
+}
+
+/*
+ * writes frame: 4 byte size (little endian) followed by first `size` bytes of
+ * buffer, e.g. buffer filled by OutputBufferAdapter and `size` is
+ * writtenBytesCount.
+ * returns false on error, or if `size` doesn't fit in 4 bytes.
+ */
+template<typename Reactor, typename Buffer>
+AsyncTask<bool>
+asyncWriteFrame(Reactor& reactor, int fd, const Buffer& buffer, size_t size)
+{
+  if (static_cast<uint64_t>(size) > UINT32_MAX)
+    co_return false;
+  uint8_t header[4]{};
+  const auto frameSize = static_cast<uint32_t>(size);
+  for (auto i = 0u; i < 4u; ++i)
+    header[i] = static_cast<uint8_t>(frameSize >> (i * 8u));
+  if (!co_await asyncWriteAll(reactor, fd, header, sizeof(header)))
+    co_return false;
+  if (size == 0)
+    co_return true;
+  co_return co_await asyncWriteAll(
+    reactor, fd, details::asyncBufferData(buffer), size);
+}
+
+/*
+ * reads frame written by asyncWriteFrame, resizes buffer if it is too small
+ * (fails for fixed size buffers) and sets `size` to frame size, so that it can
+ * be read by InputBufferAdapter.
+ * returns false on error, end of stream, or if frame is bigger than `maxSize`.
+ */
+template<typename Reactor, typename Buffer>
+AsyncTask<bool>
+asyncReadFrame(Reactor& reactor,
+               int fd,
+               Buffer& buffer,
+               size_t maxSize,
+               size_t& size)
+{
+  using TTraits = traits::ContainerTraits<Buffer>;
+  uint8_t header[4]{};
+  if (!co_await asyncReadAll(reactor, fd, header, sizeof(header)))
+    co_return false;
+  uint32_t frameSize{};
+  for (auto i = 0u; i < 4u; ++i)
+    frameSize |= static_cast<uint32_t>(header[i]) << (i * 8u);
+  if (frameSize > maxSize)
+    co_return false;
+  size = frameSize;
+  if (size == 0)
+    co_return true;
+  if (TTraits::size(buffer) < size) {
+    if constexpr (TTraits::isResizable)
+      TTraits::resize(buffer, size);
+    else
+      co_return false;
+  }
+  co_return co_await asyncReadAll(
+    reactor, fd, details::asyncBufferData(buffer), size);
+}
+
+}
+
+#endif // BITSERY_ADAPTER_ASYNC_FD_H
@@ -54,6 +54,9 @@ public:
                 "BufferAdapter only works with contiguous containers");
   static_assert(sizeof(TValue) == 1,
                 "BufferAdapter underlying type must be 1byte.");
+  // adapter that reads fixed size region without bounds checks
+  using TUncheckedRegion =
+    InputBufferAdapter<Buffer, details::UncheckedRegionConfig<Config>>;
 
   InputBufferAdapter(TIterator beginIt, size_t size)
     : _beginIt{ beginIt }
@@ -127,6 +130,45 @@ public:
 
   bool isCompletedSuccessfully() const { return _currOffset == _bufferSize; }
 
+  // reads size prefix (see details::readSize) with single bounds check.
+  // returns false, if there is less than 4 bytes left, or it is extended size
+  // marker, so that size must be read by generic path
+  bool readSizeFast(size_t& size)
+  {
+    if (_currOffset + 4u > _endReadOffset)
+      return false;
+    const auto it = _beginIt + static_cast<diff_t>(_currOffset);
+    const uint32_t b0 = static_cast<uint8_t>(it[0]);
+    const uint32_t b1 = static_cast<uint8_t>(it[1]);
+    const uint32_t b2 = static_cast<uint8_t>(it[2]);
+    const uint32_t b3 = static_cast<uint8_t>(it[3]);
+    // last two bytes of 4 byte size are written as uint16 in config endianness
+    const uint32_t lw = Config::Endianness == EndiannessType::LittleEndian
+                          ? (b3 << 8) | b2
+                          : (b2 << 8) | b3;
+    const uint32_t v2 = ((b0 & 0x7Fu) << 8) | b1;
+    const uint32_t v4 = ((b0 & 0x3Fu) << 24) | (b1 << 16) | lw;
+    // 0 and 1 is 1 byte size, 2 is 2 bytes, 3 is 4 bytes
+    const uint32_t sizeClass = b0 >> 6;
+    if (sizeClass == 2u && v2 == 0u)
+      return false;
+    size = sizeClass < 2u ? b0 : (sizeClass == 2u ? v2 : v4);
+    _currOffset += (0x4211u >> (sizeClass * 4u)) & 0xFu;
+    return true;
+  }
+
+  // if `size` bytes are available for reading, returns true and sets `begin`
+  // to current read position, so that region can be read by unchecked adapter.
+  // read position is not changed.
+  bool uncheckedRegionBegin(size_t size, TIterator& begin) const
+  {
+    if (_currOffset + size <= _endReadOffset) {
+      begin = _beginIt + static_cast<diff_t>(_currOffset);
+      return true;
+    }
+    return false;
+  }
+
 private:
   using diff_t = typename std::iterator_traits<TIterator>::difference_type;
 
@@ -143,9 +185,19 @@ private:
       data, size, std::integral_constant<bool, Config::CheckAdapterErrors>{});
   }
 
+  void skipInternal(size_t size)
+  {
+    skipInternalImpl(
+      size, std::integral_constant<bool, Config::CheckAdapterErrors>{});
+  }
+
   void readInternalImpl(TValue* data, size_t size, std::false_type)
   {
     const size_t newOffset = _currOffset + size;
+    if (!isWithinRegion(newOffset)) {
+      std::memset(data, 0, size);
+      return;
+    }
     assert(newOffset <= _endReadOffset);
     std::copy_n(_beginIt + static_cast<diff_t>(_currOffset), size, data);
     _currOffset = newOffset;
@@ -165,6 +217,44 @@ private:
     }
   }
 
+  void skipInternalImpl(size_t size, std::false_type)
+  {
+    const size_t newOffset = _currOffset + size;
+    if (!isWithinRegion(newOffset))
+      return;
+    assert(newOffset <= _endReadOffset);
+    _currOffset = newOffset;
+  }
+
+  // fixed size region adapter sets DataOverflow instead of reading past the
+  // end of region, so that wrong region size is an error in release builds
+  bool isWithinRegion(size_t newOffset)
+  {
+    return isWithinRegion(newOffset,
+                          details::IsUncheckedRegionConfig<Config>{});
+  }
+
+  bool isWithinRegion(size_t newOffset, std::true_type)
+  {
+    if (newOffset <= _endReadOffset)
+      return true;
+    error(ReaderError::DataOverflow);
+    return false;
+  }
+
+  bool isWithinRegion(size_t, std::false_type) { return true; }
+
+  void skipInternalImpl(size_t size, std::true_type)
+  {
+    const size_t newOffset = _currOffset + size;
+    if (newOffset <= _endReadOffset) {
+      _currOffset = newOffset;
+    } else {
+      if (_overflowOnReadEndPos)
+        error(ReaderError::DataOverflow);
+    }
+  }
+
   void currentReadPosChecked(size_t pos, std::true_type)
   {
     if (_bufferSize >= pos && error() == ReaderError::NoError) {
@@ -245,6 +335,34 @@ public:
     return _currOffset > _biggestCurrentPos ? _currOffset : _biggestCurrentPos;
   }
 
+  // writes size prefix (see details::writeSize) with single bounds check.
+  // returns false for sizes that require extended encoding
+  bool writeSizeFast(size_t size)
+  {
+    if (size >= 0x40000000u)
+      return false;
+    TValue tmp[4]{};
+    size_t length{};
+    if (size < 0x80u) {
+      tmp[0] = static_cast<TValue>(size);
+      length = 1;
+    } else if (size < 0x4000u) {
+      tmp[0] = static_cast<TValue>((size >> 8) | 0x80u);
+      tmp[1] = static_cast<TValue>(size);
+      length = 2;
+    } else {
+      tmp[0] = static_cast<TValue>((size >> 24) | 0xC0u);
+      tmp[1] = static_cast<TValue>(size >> 16);
+      // last two bytes are written as uint16 in config endianness
+      const bool isLittle = Config::Endianness == EndiannessType::LittleEndian;
+      tmp[2] = static_cast<TValue>(isLittle ? size : size >> 8);
+      tmp[3] = static_cast<TValue>(isLittle ? size >> 8 : size);
+      length = 4;
+    }
+    writeInternalImpl(tmp, length);
+    return true;
+  }
+
 private:
   using TResizable =
     std::integral_constant<bool, traits::ContainerTraits<Buffer>::isResizable>;
@@ -115,6 +115,19 @@ private:
       data, size, std::integral_constant<bool, Config::CheckAdapterErrors>{});
   }
 
+  void skipInternal(size_t size)
+  {
+    // streams cannot jump, so read to temporary buffer in small chunks
+    TValue tmp[64];
+    constexpr size_t chunkSize = sizeof(tmp) / sizeof(TValue);
+    while (size > 0) {
+      const auto chunk = (std::min)(size, chunkSize);
+      readChecked(
+        tmp, chunk, std::integral_constant<bool, Config::CheckAdapterErrors>{});
+      size -= chunk;
+    }
+  }
+
   void readChecked(TValue* data, size_t size, std::true_type)
   {
     if (size - static_cast<size_t>(_ios->rdbuf()->sgetn(
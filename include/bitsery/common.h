@@ -47,6 +47,10 @@ struct DefaultConfig
   // enables/disables checks for other errors that can significantly affect
   // performance
   static constexpr bool CheckDataErrors = true;
+  // enables extended size encoding for container/text sizes >= 2^30 (1GiB).
+  // data written without it stays readable, but data with large sizes cannot
+  // be read if it is disabled. this flag is optional in custom configs.
+  static constexpr bool SupportLargeSizes = false;
 };
 
 }
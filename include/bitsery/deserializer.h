@@ -36,6 +36,11 @@ public:
   // deserialize function when enabling bitpacking
   using BPEnabledType =
     Deserializer<typename TInputAdapter::BitPackingEnabled, TContext>;
+  // helper type, that is passed to `fixedSizeRegion` function, it reads
+  // without per-read bounds checks if adapter supports it
+  using FixedRegionType = Deserializer<
+    typename details::UncheckedRegionAdapter<TInputAdapter>::type,
+    TContext>;
   using TConfig = typename TInputAdapter::TConfig;
 
   using details::AdapterAndContextRef<TInputAdapter,
@@ -94,6 +99,20 @@ public:
       std::is_same<TInputAdapter, typename TInputAdapter::BitPackingEnabled>{});
   }
 
+  /*
+   * fixed size region, bounds are checked once for whole region, and then it
+   * is read without per-read error tracking. `size` must be exact number of
+   * bytes that `fnc` reads. if there is not enough data, `fnc` is not invoked.
+   * if `fnc` reads more than `size` bytes, reads are not done past the end of
+   * region and DataOverflow error is set.
+   */
+  template<typename Fnc>
+  void fixedSizeRegion(size_t size, Fnc&& fnc)
+  {
+    procFixedSizeRegion(
+      size, fnc, std::is_same<FixedRegionType, Deserializer>{});
+  }
+
   /*
    * extension functions
    */
@@ -316,31 +335,31 @@ public:
   template<typename T, typename Ext>
   void ext1b(T& v, Ext&& extension)
   {
-    ext<1, T, Ext>(v, std::forward<Ext>(extension));
+    ext<1>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext2b(T& v, Ext&& extension)
   {
-    ext<2, T, Ext>(v, std::forward<Ext>(extension));
+    ext<2>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext4b(T& v, Ext&& extension)
   {
-    ext<4, T, Ext>(v, std::forward<Ext>(extension));
+    ext<4>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext8b(T& v, Ext&& extension)
   {
-    ext<8, T, Ext>(v, std::forward<Ext>(extension));
+    ext<8>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext16b(T& v, Ext&& extension)
   {
-    ext<16, T, Ext>(v, std::forward<Ext>(extension));
+    ext<16>(v, std::forward<Ext>(extension));
   }
 
   template<typename T>
@@ -439,6 +458,76 @@ public:
     container<16>(std::forward<T>(obj));
   }
 
+  /*
+   * skip functions, advance read position without materializing data
+   */
+
+  template<size_t VSIZE>
+  void skipValue()
+  {
+    this->_adapter.skipBytes(VSIZE);
+  }
+
+  template<size_t VSIZE>
+  void skipText(size_t maxSize)
+  {
+    size_t length{};
+    readSize(length, maxSize);
+    this->_adapter.skipBytes(length * VSIZE);
+  }
+
+  // container of fundamental types, same as container<VSIZE>(obj, maxSize)
+  template<size_t VSIZE>
+  void skipContainer(size_t maxSize)
+  {
+    size_t size{};
+    readSize(size, maxSize);
+    this->_adapter.skipBytes(size * VSIZE);
+  }
+
+  // container with non-trivial elements, fnc must skip one element
+  template<typename Fnc>
+  void skipContainer(size_t maxSize, Fnc&& fnc)
+  {
+    size_t size{};
+    readSize(size, maxSize);
+    for (; size > 0; --size)
+      fnc(*this);
+  }
+
+  // skip object serialized via extension, extension must implement `skip`
+  template<typename Ext>
+  void skipExt(const Ext& extension)
+  {
+    extension.skip(*this);
+  }
+
+  void skipValue1b() { skipValue<1>(); }
+
+  void skipValue2b() { skipValue<2>(); }
+
+  void skipValue4b() { skipValue<4>(); }
+
+  void skipValue8b() { skipValue<8>(); }
+
+  void skipValue16b() { skipValue<16>(); }
+
+  void skipText1b(size_t maxSize) { skipText<1>(maxSize); }
+
+  void skipText2b(size_t maxSize) { skipText<2>(maxSize); }
+
+  void skipText4b(size_t maxSize) { skipText<4>(maxSize); }
+
+  void skipContainer1b(size_t maxSize) { skipContainer<1>(maxSize); }
+
+  void skipContainer2b(size_t maxSize) { skipContainer<2>(maxSize); }
+
+  void skipContainer4b(size_t maxSize) { skipContainer<4>(maxSize); }
+
+  void skipContainer8b(size_t maxSize) { skipContainer<8>(maxSize); }
+
+  void skipContainer16b(size_t maxSize) { skipContainer<16>(maxSize); }
+
 private:
   void readSize(size_t& size, size_t maxSize)
   {
@@ -450,12 +539,29 @@ private:
   }
 
   // process value types
-  // false_type means that we must process all elements individually
+  // false_type means that we must process all elements individually,
+  // but bounds can be checked once for all elements
   template<size_t VSIZE, typename It>
   void procContainer(It first, It last, std::false_type)
+  {
+    const auto size =
+      static_cast<size_t>(std::distance(first, last)) * VSIZE;
+    // if there is not enough data, read with checks, so that values are
+    // zero-filled (e.g. new fields when reading old data in Growable session)
+    if (isFixedSizeRegionAvailable(
+          size, std::is_same<FixedRegionType, Deserializer>{}))
+      fixedSizeRegion(size, [first, last](FixedRegionType& des) {
+        readValues<VSIZE>(des, first, last);
+      });
+    else
+      readValues<VSIZE>(*this, first, last);
+  }
+
+  template<size_t VSIZE, typename Des, typename It>
+  static void readValues(Des& des, It first, It last)
   {
     for (; first != last; ++first)
-      value<VSIZE>(*first);
+      des.template value<VSIZE>(*first);
   }
 
   // process value types
@@ -555,6 +661,51 @@ private:
     return BPEnabledType{ this->_adapter };
   }
 
+  bool isFixedSizeRegionAvailable(size_t, std::true_type) const
+  {
+    return false;
+  }
+
+  bool isFixedSizeRegionAvailable(size_t size, std::false_type) const
+  {
+    typename TInputAdapter::TIterator begin{};
+    return this->_adapter.uncheckedRegionBegin(size, begin);
+  }
+
+  // adapter doesn't support unchecked regions
+  template<typename Fnc>
+  void procFixedSizeRegion(size_t, Fnc& fnc, std::true_type)
+  {
+    fnc(*this);
+  }
+
+  template<typename Fnc>
+  void procFixedSizeRegion(size_t size, Fnc& fnc, std::false_type)
+  {
+    typename TInputAdapter::TIterator begin{};
+    if (this->_adapter.uncheckedRegionBegin(size, begin)) {
+      auto des = createFixedRegion(
+        begin, size, std::integral_constant<bool, Deserializer::HasContext>{});
+      fnc(des);
+      if (des.adapter().error() != ReaderError::NoError)
+        this->_adapter.error(ReaderError::DataOverflow);
+    }
+    // advance read position or set error if there is not enough data
+    this->_adapter.skipBytes(size);
+  }
+
+  template<typename It>
+  FixedRegionType createFixedRegion(It begin, size_t size, std::true_type)
+  {
+    return FixedRegionType{ this->_context, begin, size };
+  }
+
+  template<typename It>
+  FixedRegionType createFixedRegion(It begin, size_t size, std::false_type)
+  {
+    return FixedRegionType{ begin, size };
+  }
+
   // these are dummy functions for extensions that have TValue = void
   void object(details::DummyType&) {}
 
@@ -86,6 +86,17 @@ public:
     readBitsInternal(v, bitsCount);
   }
 
+  void skipBytes(size_t count)
+  {
+    if (!m_scratchBits) {
+      this->_wrapped.skipBytes(count);
+    } else {
+      UnsignedValue tmp{};
+      for (size_t i = 0; i < count; ++i)
+        readBitsInternal(tmp, details::BitsSize<UnsignedValue>::value);
+    }
+  }
+
   void align()
   {
     if (m_scratchBits) {
@@ -43,10 +43,109 @@ enum class ReaderError
 
 namespace details {
 
+/*
+ * fixed size regions
+ * input adapter might provide an adapter type for regions whose size is
+ * checked upfront, so that region can be read without per-read bounds checks.
+ */
+
+template<typename Config>
+struct UncheckedRegionConfig : public Config
+{
+  static constexpr bool CheckAdapterErrors = false;
+};
+
+// region adapter doesn't support read end position, but it still doesn't read
+// past the end of region, in case region size is wrong
+template<typename Config>
+struct IsUncheckedRegionConfig : std::false_type
+{
+};
+
+template<typename Config>
+struct IsUncheckedRegionConfig<UncheckedRegionConfig<Config>> : std::true_type
+{
+};
+
+template<typename Adapter>
+struct HasUncheckedRegionHelper
+{
+  template<typename Q, typename = typename Q::TUncheckedRegion>
+  static std::true_type tester(Q*);
+  static std::false_type tester(...);
+  using type = decltype(tester(static_cast<Adapter*>(nullptr)));
+};
+
+template<typename Adapter>
+struct HasUncheckedRegion : HasUncheckedRegionHelper<Adapter>::type
+{
+};
+
+// returns adapter type for reading fixed size regions,
+// or same adapter if it is not supported or adapter is already unchecked
+template<typename Adapter,
+         bool Enabled = HasUncheckedRegion<Adapter>::value &&
+                        Adapter::TConfig::CheckAdapterErrors>
+struct UncheckedRegionAdapter
+{
+  using type = Adapter;
+};
+
+template<typename Adapter>
+struct UncheckedRegionAdapter<Adapter, true>
+{
+  using type = typename Adapter::TUncheckedRegion;
+};
+
 /**
  * size read/write functions
+ * sizes are encoded in 1, 2 or 4 bytes, that support up to 30bit sizes.
+ * if config enables SupportLargeSizes, bigger sizes are written as 2 byte
+ * marker (0x80 0x00), that was never produced for smaller sizes, followed by 8
+ * byte size.
  */
 
+template<typename Config>
+struct HasSupportLargeSizesHelper
+{
+  template<typename Q, typename = decltype(Q::SupportLargeSizes)>
+  static std::true_type tester(Q*);
+  static std::false_type tester(...);
+  using type = decltype(tester(static_cast<Config*>(nullptr)));
+};
+
+template<typename Config,
+         bool = HasSupportLargeSizesHelper<Config>::type::value>
+struct SupportLargeSizes : std::false_type
+{
+};
+
+template<typename Config>
+struct SupportLargeSizes<Config, true>
+  : std::integral_constant<bool, Config::SupportLargeSizes>
+{
+};
+
+template<typename Reader>
+void
+readLargeSize(Reader& r, size_t& size, std::true_type)
+{
+  uint64_t tmp{};
+  r.template readBytes<8>(tmp);
+  size = static_cast<size_t>(tmp);
+  // size doesn't fit in size_t on this platform
+  if (static_cast<uint64_t>(size) != tmp) {
+    r.error(ReaderError::InvalidData);
+    size = {};
+  }
+}
+
+template<typename Reader>
+void
+readLargeSize(Reader&, size_t&, std::false_type)
+{
+}
+
 template<typename Reader>
 void
 handleReadMaxSize(Reader& r, size_t& size, size_t maxSize, std::true_type)
@@ -63,12 +162,55 @@ handleReadMaxSize(Reader&, size_t&, size_t, std::false_type)
 {
 }
 
-template<typename Reader, bool CheckMaxSize>
+// adapter might implement size read/write with single bounds check,
+// e.g. buffer adapter. it returns false when generic path must be used.
+template<typename Adapter>
+struct HasFastSizeHelper
+{
+  template<typename Q,
+           typename = decltype(std::declval<Q&>().readSizeFast(
+             std::declval<size_t&>()))>
+  static std::true_type testerRead(Q*);
+  static std::false_type testerRead(...);
+  template<typename Q,
+           typename = decltype(std::declval<Q&>().writeSizeFast(size_t{}))>
+  static std::true_type testerWrite(Q*);
+  static std::false_type testerWrite(...);
+  using read = decltype(testerRead(static_cast<Adapter*>(nullptr)));
+  using write = decltype(testerWrite(static_cast<Adapter*>(nullptr)));
+};
+
+template<typename Reader>
+bool
+readSizeFast(Reader& r, size_t& size, std::true_type)
+{
+  return r.readSizeFast(size);
+}
+
+template<typename Reader>
+bool
+readSizeFast(Reader&, size_t&, std::false_type)
+{
+  return false;
+}
+
+template<typename Writer>
+bool
+writeSizeFast(Writer& w, size_t size, std::true_type)
+{
+  return w.writeSizeFast(size);
+}
+
+template<typename Writer>
+bool
+writeSizeFast(Writer&, size_t, std::false_type)
+{
+  return false;
+}
+
+template<typename Reader>
 void
-readSize(Reader& r,
-         size_t& size,
-         size_t maxSize,
-         std::integral_constant<bool, CheckMaxSize> checkMaxSize)
+readSizeGeneric(Reader& r, size_t& size)
 {
   uint8_t hb{};
   r.template readBytes<1>(hb);
@@ -83,8 +225,21 @@ readSize(Reader& r,
       size = ((((hb & 0x3Fu) << 8) | lb) << 16) | lw;
     } else {
       size = ((hb & 0x7Fu) << 8) | lb;
+      if (size == 0)
+        readLargeSize(r, size, SupportLargeSizes<typename Reader::TConfig>{});
     }
   }
+}
+
+template<typename Reader, bool CheckMaxSize>
+void
+readSize(Reader& r,
+         size_t& size,
+         size_t maxSize,
+         std::integral_constant<bool, CheckMaxSize> checkMaxSize)
+{
+  if (!readSizeFast(r, size, typename HasFastSizeHelper<Reader>::read{}))
+    readSizeGeneric(r, size);
   handleReadMaxSize(r, size, maxSize, checkMaxSize);
 }
 
@@ -92,13 +247,21 @@ template<typename Writer>
 void
 writeSize(Writer& w, const size_t size)
 {
+  if (writeSizeFast(w, size, typename HasFastSizeHelper<Writer>::write{}))
+    return;
   if (size < 0x80u) {
     w.template writeBytes<1>(static_cast<uint8_t>(size));
   } else {
     if (size < 0x4000u) {
       w.template writeBytes<1>(static_cast<uint8_t>((size >> 8) | 0x80u));
       w.template writeBytes<1>(static_cast<uint8_t>(size));
+    } else if (SupportLargeSizes<typename Writer::TConfig>::value &&
+               size >= 0x40000000u) {
+      w.template writeBytes<1>(static_cast<uint8_t>(0x80u));
+      w.template writeBytes<1>(static_cast<uint8_t>(0u));
+      w.template writeBytes<8>(static_cast<uint64_t>(size));
     } else {
+      // enable SupportLargeSizes in config, to write sizes >= 2^30
       assert(size < 0x40000000u);
       w.template writeBytes<1>(static_cast<uint8_t>((size >> 24) | 0xC0u));
       w.template writeBytes<1>(static_cast<uint8_t>(size >> 16));
@@ -375,6 +538,12 @@ struct InputAdapterBaseCRTP
     swapDataBits(buf, count, ShouldSwap<typename Adapter::TConfig, T>{});
   }
 
+  // advance read position without reading data
+  void skipBytes(size_t count)
+  {
+    static_cast<Adapter*>(this)->skipInternal(count);
+  }
+
   template<typename T>
   void readBits(T&, size_t)
   {
@@ -248,6 +248,38 @@ struct IsBriefSyntaxIncluded<
 struct DummyType
 {};
 
+// detects containers that has node handles (e.g. std::map since c++17)
+template<typename T>
+struct HasNodeHandleHelper
+{
+  template<typename Q, typename = typename Q::node_type>
+  static std::true_type tester(Q*);
+  static std::false_type tester(...);
+  using type = decltype(tester(static_cast<T*>(nullptr)));
+};
+
+template<typename T>
+struct HasNodeHandle : HasNodeHandleHelper<T>::type
+{
+};
+
+// creates empty associative container with the same hash and key equality
+// (unordered containers) or comparator, and allocator as `obj`
+template<typename T>
+auto
+createEmptyLike(const T& obj, int)
+  -> decltype(T(0, obj.hash_function(), obj.key_eq(), obj.get_allocator()))
+{
+  return T(0, obj.hash_function(), obj.key_eq(), obj.get_allocator());
+}
+
+template<typename T>
+T
+createEmptyLike(const T& obj, long)
+{
+  return T(obj.key_comp(), obj.get_allocator());
+}
+
 /*
  * this includes all integral types, floats and enums(except bool)
  */
@@ -404,8 +436,27 @@ struct IsExistsConvertibleTupleType<T, std::tuple<Us...>>
 {
 };
 
+// true if TCast can be obtained from context, void context has no types
+template<typename TCast, typename TContext>
+struct HasContextType : std::is_convertible<TContext&, TCast&>
+{
+};
+
+template<typename TCast>
+struct HasContextType<TCast, void> : std::false_type
+{
+};
+
+template<typename TCast, typename... TArgs>
+struct HasContextType<TCast, std::tuple<TArgs...>>
+  : IsExistsConvertibleTupleType<TCast, std::tuple<TArgs...>>
+{
+};
+
 /*
  * get context from internal or external, and check if it's convertible or not
+ * context type (and tuple index) is resolved at compile time, so getting
+ * context is the same as taking address of a member, there is no runtime search
  */
 
 template<bool AssertExists, typename TCast, typename TContext>
@@ -487,16 +538,25 @@ public:
    * get serialization context.
    * this is optional, but might be required for some specific serialization
    * flows.
+   * lookup is resolved at compile time and compiles to a single load of
+   * context reference (plus constant offset for tuple element), so extensions
+   * can call it for every element.
    */
 
   template<typename T>
-  T& context()
+  static constexpr bool hasContext()
+  {
+    return HasContextType<T, Context>::value;
+  }
+
+  template<typename T>
+  T& context() noexcept
   {
     return *getContext<true, T>(_context);
   }
 
   template<typename T>
-  T* contextOrNull()
+  T* contextOrNull() noexcept
   {
     return getContext<false, T>(_context);
   }
@@ -523,6 +583,12 @@ public:
   {
   }
 
+  template<typename T>
+  static constexpr bool hasContext()
+  {
+    return false;
+  }
+
   template<typename T>
   T& context()
   {
@@ -530,7 +596,7 @@ public:
   }
 
   template<typename T>
-  T* contextOrNull()
+  T* contextOrNull() noexcept
   {
     return nullptr;
   }
@@ -0,0 +1,250 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_COLUMNAR_H
+#define BITSERY_EXT_COLUMNAR_H
+
+#include "../details/serialization_common.h"
+#include "compact_value.h"
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#if __cplusplus < 201703L
+#error Columnar requires c++17
+// columns are passed as variadic arguments, and without class template
+// argument deduction guides it would be very inconvenient to use
+#endif
+
+namespace bitsery {
+
+namespace ext {
+
+enum class ColumnEncoding
+{
+  // values are written as contiguous buffer, same as container<N>
+  Raw,
+  // each value is written as CompactValue
+  Varint,
+  // difference from previous value is written as CompactValue
+  Delta
+};
+
+template<typename T, typename M, ColumnEncoding Encoding>
+struct Column
+{
+  M T::*member;
+};
+
+// create column for a member of record type.
+// fundamental types support all encodings, other types are serialized as
+// objects one after another.
+template<ColumnEncoding Encoding = ColumnEncoding::Raw,
+         typename T,
+         typename M>
+constexpr Column<T, M, Encoding>
+column(M T::*member)
+{
+  return Column<T, M, Encoding>{ member };
+}
+
+/*
+ * serializes container of records column by column (struct-of-arrays),
+ * so that each member becomes its own contiguous run.
+ * data layout:
+ *  [size][1st column for all records][2nd column for all records]...
+ * raw columns of fundamental types are written as contiguous run of values,
+ * same as container<N>, directly from/to records (without temporary buffer).
+ */
+template<typename... Columns>
+class Columnar
+{
+public:
+  static_assert(sizeof...(Columns) > 0, "at least one column is required");
+
+  constexpr explicit Columnar(size_t maxSize, Columns... columns)
+    : _maxSize{ maxSize }
+    , _columns{ columns... }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    const auto size = traits::ContainerTraits<T>::size(obj);
+    assert(size <= _maxSize);
+    details::writeSize(ser.adapter(), size);
+    std::apply(
+      [&ser, &obj](const auto&... column) {
+        (writeColumn(ser, obj, column), ...);
+      },
+      _columns);
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    static_assert(traits::ContainerTraits<T>::isResizable,
+                  "Columnar requires resizable container");
+    size_t size{};
+    details::readSize(
+      des.adapter(),
+      size,
+      _maxSize,
+      std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
+    traits::ContainerTraits<T>::resize(obj, size);
+    std::apply(
+      [&des, &obj](const auto&... column) {
+        (readColumn(des, obj, column), ...);
+      },
+      _columns);
+  }
+
+private:
+  // column member can also be declared in a base class of the record
+  template<typename T, typename R>
+  static constexpr bool isColumnOf()
+  {
+    return std::is_base_of_v<
+      R,
+      std::decay_t<decltype(*std::begin(std::declval<T&>()))>>;
+  }
+
+  // floats and enums are copied bitwise to/from same size integral, instead
+  // of reinterpret_cast that breaks strict aliasing
+  template<typename TIntegral, typename M>
+  static TIntegral toIntegral(const M& member)
+  {
+    static_assert(sizeof(TIntegral) == sizeof(M), "");
+    TIntegral res{};
+    std::memcpy(&res, &member, sizeof(M));
+    return res;
+  }
+
+  template<typename TIntegral, typename M>
+  static void fromIntegral(M& member, const TIntegral& value)
+  {
+    static_assert(sizeof(TIntegral) == sizeof(M), "");
+    std::memcpy(&member, &value, sizeof(M));
+  }
+
+  template<typename Ser, typename T, typename R, typename M, ColumnEncoding E>
+  static void writeColumn(Ser& ser, const T& obj, const Column<R, M, E>& column)
+  {
+    static_assert(isColumnOf<T, R>(),
+                  "Column must be a member of container's value type, or "
+                  "its base.");
+    if constexpr (!details::IsFundamentalType<M>::value) {
+      for (auto& v : obj)
+        ser.object(v.*column.member);
+    } else if constexpr (E == ColumnEncoding::Raw) {
+      using TIntegral = typename details::IntegralFromFundamental<M>::TValue;
+      auto& writer = ser.adapter();
+      for (auto& v : obj)
+        writer.template writeBytes<sizeof(M)>(
+          toIntegral<TIntegral>(v.*column.member));
+    } else {
+      static_assert(std::is_integral<M>::value || std::is_enum<M>::value,
+                    "Varint and Delta encodings require integral type");
+      using TIntegral = typename details::IntegralFromFundamental<M>::TValue;
+      using TUnsigned = details::SameSizeUnsigned<M>;
+      details::CompactValueImpl<true> compact{};
+      TUnsigned prev{};
+      for (auto& v : obj) {
+        const auto value = toIntegral<TIntegral>(v.*column.member);
+        if constexpr (E == ColumnEncoding::Delta) {
+          const auto curr = static_cast<TUnsigned>(value);
+          // wraps around, so that any difference fits in same size type
+          const auto delta = static_cast<std::make_signed_t<TUnsigned>>(
+            static_cast<TUnsigned>(curr - prev));
+          prev = curr;
+          compact.serialize(ser, delta, 0);
+        } else {
+          compact.serialize(ser, value, 0);
+        }
+      }
+    }
+  }
+
+  template<typename Des, typename T, typename R, typename M, ColumnEncoding E>
+  static void readColumn(Des& des, T& obj, const Column<R, M, E>& column)
+  {
+    static_assert(isColumnOf<T, R>(),
+                  "Column must be a member of container's value type, or "
+                  "its base.");
+    if constexpr (!details::IsFundamentalType<M>::value) {
+      for (auto& v : obj)
+        des.object(v.*column.member);
+    } else if constexpr (E == ColumnEncoding::Raw) {
+      using TIntegral = typename details::IntegralFromFundamental<M>::TValue;
+      auto& reader = des.adapter();
+      for (auto& v : obj) {
+        TIntegral value{};
+        reader.template readBytes<sizeof(M)>(value);
+        fromIntegral(v.*column.member, value);
+      }
+    } else {
+      static_assert(std::is_integral<M>::value || std::is_enum<M>::value,
+                    "Varint and Delta encodings require integral type");
+      using TIntegral = typename details::IntegralFromFundamental<M>::TValue;
+      using TUnsigned = details::SameSizeUnsigned<M>;
+      details::CompactValueImpl<true> compact{};
+      TUnsigned prev{};
+      for (auto& v : obj) {
+        TIntegral value{};
+        if constexpr (E == ColumnEncoding::Delta) {
+          std::make_signed_t<TUnsigned> delta{};
+          compact.deserialize(des, delta, 0);
+          prev = static_cast<TUnsigned>(prev + static_cast<TUnsigned>(delta));
+          value = static_cast<TIntegral>(prev);
+        } else {
+          compact.deserialize(des, value, 0);
+        }
+        fromIntegral(v.*column.member, value);
+      }
+    }
+  }
+
+  size_t _maxSize;
+  std::tuple<Columns...> _columns;
+};
+
+// deduction guide
+template<typename... Columns>
+Columnar(size_t, Columns...) -> Columnar<Columns...>;
+
+}
+
+namespace traits {
+template<typename T, typename... Columns>
+struct ExtensionTraits<ext::Columnar<Columns...>, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_COLUMNAR_H
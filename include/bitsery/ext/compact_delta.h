@@ -0,0 +1,288 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_COMPACT_DELTA_H
+#define BITSERY_EXT_COMPACT_DELTA_H
+
+#include "../details/serialization_common.h"
+#include "compact_value.h"
+#include <algorithm>
+
+namespace bitsery {
+
+namespace details {
+
+template<bool BitPacked>
+class CompactDeltaImpl
+{
+public:
+  constexpr explicit CompactDeltaImpl(size_t maxSize)
+    : _maxSize{ maxSize }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    assertValueType<T>();
+    const auto size = traits::ContainerTraits<T>::size(obj);
+    assert(size <= _maxSize);
+    writeContainerSize(ser.adapter(), size, IsResizable<T>{});
+    writeDeltas(ser.adapter(),
+                std::begin(obj),
+                size,
+                std::integral_constant<bool, BitPacked>{});
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    assertValueType<T>();
+    const auto size = readContainerSize(des.adapter(), obj, IsResizable<T>{});
+    readDeltas(des.adapter(),
+               std::begin(obj),
+               size,
+               std::integral_constant<bool, BitPacked>{});
+  }
+
+private:
+  // number of values that share same frame of reference and bits width
+  static constexpr size_t BlockSize = 128u;
+
+  template<typename T>
+  using IsResizable =
+    std::integral_constant<bool, traits::ContainerTraits<T>::isResizable>;
+
+  template<typename T>
+  static void assertValueType()
+  {
+    using TValue = typename traits::ContainerTraits<T>::TValue;
+    static_assert(IsFundamentalType<TValue>::value &&
+                    !std::is_floating_point<TValue>::value,
+                  "CompactDelta requires container of integral or enum types");
+  }
+
+  template<typename Writer>
+  void writeContainerSize(Writer& w, size_t size, std::true_type) const
+  {
+    writeSize(w, size);
+  }
+
+  template<typename Writer>
+  void writeContainerSize(Writer&, size_t, std::false_type) const
+  {
+  }
+
+  template<typename Reader, typename T>
+  size_t readContainerSize(Reader& r, T& obj, std::true_type) const
+  {
+    size_t size{};
+    readSize(r,
+             size,
+             _maxSize,
+             std::integral_constant<bool, Reader::TConfig::CheckDataErrors>{});
+    traits::ContainerTraits<T>::resize(obj, size);
+    return size;
+  }
+
+  template<typename Reader, typename T>
+  size_t readContainerSize(Reader&, T& obj, std::false_type) const
+  {
+    return traits::ContainerTraits<T>::size(obj);
+  }
+
+  // differences are computed with wrap around, so that any difference fits in
+  // same size type
+  template<typename Writer, typename It>
+  void writeDeltas(Writer& w, It it, size_t size, std::false_type) const
+  {
+    using TIntegral = typename IntegralFromFundamental<
+      typename std::decay<decltype(*it)>::type>::TValue;
+    using TUnsigned = typename std::make_unsigned<TIntegral>::type;
+    using TSigned = typename std::make_signed<TIntegral>::type;
+    TUnsigned prev{};
+    for (size_t i = 0; i < size; ++i, ++it) {
+      const auto curr =
+        static_cast<TUnsigned>(reinterpret_cast<const TIntegral&>(*it));
+      const auto delta =
+        static_cast<TSigned>(static_cast<TUnsigned>(curr - prev));
+      writeVarint(w, zigZagEncode(delta, std::true_type{}));
+      prev = curr;
+    }
+  }
+
+  template<typename Reader, typename It>
+  void readDeltas(Reader& r, It it, size_t size, std::false_type) const
+  {
+    using TIntegral = typename IntegralFromFundamental<
+      typename std::decay<decltype(*it)>::type>::TValue;
+    using TUnsigned = typename std::make_unsigned<TIntegral>::type;
+    using TSigned = typename std::make_signed<TIntegral>::type;
+    TUnsigned prev{};
+    for (size_t i = 0; i < size; ++i, ++it) {
+      TUnsigned encoded{};
+      readVarint<Reader::TConfig::CheckDataErrors>(r, encoded);
+      const auto delta = zigZagDecode<TSigned>(encoded, std::true_type{});
+      prev = static_cast<TUnsigned>(prev + static_cast<TUnsigned>(delta));
+      reinterpret_cast<TIntegral&>(*it) = static_cast<TIntegral>(prev);
+    }
+  }
+
+  // first value is written as varint, and then frame-of-reference blocks:
+  // for each block, smallest difference is written as varint, then all
+  // differences are written relative to it, using the number of bits required
+  // for the largest one.
+  template<typename Writer, typename It>
+  void writeDeltas(Writer& w, It it, size_t size, std::true_type) const
+  {
+    using TIntegral = typename IntegralFromFundamental<
+      typename std::decay<decltype(*it)>::type>::TValue;
+    using TUnsigned = typename std::make_unsigned<TIntegral>::type;
+    using TSigned = typename std::make_signed<TIntegral>::type;
+    if (size == 0)
+      return;
+    auto prev =
+      static_cast<TUnsigned>(reinterpret_cast<const TIntegral&>(*it));
+    const auto first = static_cast<TSigned>(prev);
+    writeVarint(w, zigZagEncode(first, std::true_type{}));
+    ++it;
+    TUnsigned deltas[BlockSize];
+    for (size_t start = 1; start < size; start += BlockSize) {
+      const auto count = size - start < BlockSize ? size - start : BlockSize;
+      for (size_t i = 0; i < count; ++i, ++it) {
+        const auto curr =
+          static_cast<TUnsigned>(reinterpret_cast<const TIntegral&>(*it));
+        deltas[i] = static_cast<TUnsigned>(curr - prev);
+        prev = curr;
+      }
+      const auto base = *std::min_element(
+        deltas, deltas + count, [](TUnsigned lhs, TUnsigned rhs) {
+          return static_cast<TSigned>(lhs) < static_cast<TSigned>(rhs);
+        });
+      TUnsigned maxOffset{};
+      for (size_t i = 0; i < count; ++i) {
+        deltas[i] = static_cast<TUnsigned>(deltas[i] - base);
+        maxOffset = (std::max)(maxOffset, deltas[i]);
+      }
+      uint8_t bits{};
+      for (; maxOffset > 0; maxOffset = static_cast<TUnsigned>(maxOffset >> 1))
+        ++bits;
+
+      const auto signedBase = static_cast<TSigned>(base);
+      writeVarint(w, zigZagEncode(signedBase, std::true_type{}));
+      w.writeBits(bits, 7u);
+      if (bits > 0) {
+        for (size_t i = 0; i < count; ++i)
+          w.writeBits(deltas[i], bits);
+      }
+    }
+  }
+
+  template<typename Reader, typename It>
+  void readDeltas(Reader& r, It it, size_t size, std::true_type) const
+  {
+    using TIntegral = typename IntegralFromFundamental<
+      typename std::decay<decltype(*it)>::type>::TValue;
+    using TUnsigned = typename std::make_unsigned<TIntegral>::type;
+    using TSigned = typename std::make_signed<TIntegral>::type;
+    if (size == 0)
+      return;
+    TUnsigned first{};
+    readVarint<Reader::TConfig::CheckDataErrors>(r, first);
+    auto prev =
+      static_cast<TUnsigned>(zigZagDecode<TSigned>(first, std::true_type{}));
+    reinterpret_cast<TIntegral&>(*it) = static_cast<TIntegral>(prev);
+    ++it;
+    for (size_t start = 1; start < size; start += BlockSize) {
+      const auto count = size - start < BlockSize ? size - start : BlockSize;
+      TUnsigned encoded{};
+      readVarint<Reader::TConfig::CheckDataErrors>(r, encoded);
+      const auto base = static_cast<TUnsigned>(
+        zigZagDecode<TSigned>(encoded, std::true_type{}));
+      uint8_t bits{};
+      r.readBits(bits, 7u);
+      if (bits > BitsSize<TUnsigned>::value) {
+        r.error(ReaderError::InvalidData);
+        return;
+      }
+      for (size_t i = 0; i < count; ++i, ++it) {
+        TUnsigned offset{};
+        if (bits > 0)
+          r.readBits(offset, bits);
+        prev = static_cast<TUnsigned>(prev + base + offset);
+        reinterpret_cast<TIntegral&>(*it) = static_cast<TIntegral>(prev);
+      }
+    }
+  }
+
+  size_t _maxSize;
+};
+
+}
+
+namespace ext {
+
+// serializes container of integral values as the first value followed by
+// zigzag varint encoded differences between consecutive values.
+// fixed size containers doesn't write size.
+class CompactDelta : public details::CompactDeltaImpl<false>
+{
+public:
+  using details::CompactDeltaImpl<false>::CompactDeltaImpl;
+};
+
+// same as CompactDelta, but differences after the first value are written in
+// blocks of 128 values using frame-of-reference bit-packing, so that each
+// block is decoded with fixed bits width. requires bit-packing enabled.
+class CompactDeltaBitPacked : public details::CompactDeltaImpl<true>
+{
+public:
+  using details::CompactDeltaImpl<true>::CompactDeltaImpl;
+};
+
+}
+
+namespace traits {
+
+template<typename T>
+struct ExtensionTraits<ext::CompactDelta, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+
+template<typename T>
+struct ExtensionTraits<ext::CompactDeltaBitPacked, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+
+}
+
+}
+
+#endif // BITSERY_EXT_COMPACT_DELTA_H
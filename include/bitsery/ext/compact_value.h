@@ -29,6 +29,90 @@ namespace bitsery {
 
 namespace details {
 
+// zigzag encode signed types
+template<typename T>
+const SameSizeUnsigned<T>&
+zigZagEncode(const T& v, std::false_type)
+{
+  return v;
+}
+
+template<typename TResult, typename TUnsigned>
+const TResult&
+zigZagDecode(const TUnsigned& v, std::false_type)
+{
+  return v;
+}
+
+template<typename T>
+SameSizeUnsigned<T>
+zigZagEncode(const T& v, std::true_type)
+{
+  return static_cast<SameSizeUnsigned<T>>((v << 1) ^
+                                          (v >> (BitsSize<T>::value - 1)));
+}
+
+template<typename TResult, typename TUnsigned>
+TResult
+zigZagDecode(TUnsigned v, std::true_type)
+{
+  return static_cast<TResult>(
+    (v >> 1) ^
+    (~(v & 1) + 1)); // same as -(v & 1), but no warning on VisualStudio
+}
+
+// write/read unsigned value as varint, 7 bits per byte
+template<typename Writer, typename T>
+void
+writeVarint(Writer& w, const T& v)
+{
+  using TFast = typename FastType<T>::type;
+  auto val = static_cast<TFast>(v);
+  while (val > 0x7Fu) {
+    w.template writeBytes<1>(static_cast<uint8_t>(val | 0x80u));
+    val >>= 7u;
+  }
+  w.template writeBytes<1>(static_cast<uint8_t>(val));
+}
+
+template<typename Reader, typename T>
+void
+handleVarintOverflow(Reader& r,
+                     unsigned shiftedBy,
+                     uint8_t remainder,
+                     std::true_type)
+{
+  constexpr auto TBITS = sizeof(T) * 8;
+  if (shiftedBy > TBITS && remainder >> (TBITS + 7 - shiftedBy)) {
+    r.error(bitsery::ReaderError::InvalidData);
+  }
+}
+
+template<typename Reader, typename T>
+void
+handleVarintOverflow(Reader&, unsigned, uint8_t, std::false_type)
+{
+}
+
+// when `CheckOverflow` is true, sets InvalidData if value doesn't fit in T
+template<bool CheckOverflow, typename Reader, typename T>
+void
+readVarint(Reader& r, T& v)
+{
+  using TFast = typename FastType<T>::type;
+  constexpr auto TBITS = sizeof(T) * 8;
+  uint8_t b1{ 0x80u };
+  auto i = 0u;
+  TFast tmp = {};
+  for (; i < TBITS && b1 > 0x7Fu; i += 7u) {
+    r.template readBytes<1>(b1);
+    tmp += static_cast<TFast>(b1 & 0x7Fu) << i;
+  }
+  v = static_cast<T>(tmp);
+  handleVarintOverflow<Reader, T>(
+    r, i, b1, std::integral_constant<bool, CheckOverflow>{});
+}
+
 template<bool CheckOverflow>
 class CompactValueImpl
 {
@@ -73,7 +157,7 @@ private:
   {
     auto val = zigZagEncode(
       v, std::is_signed<typename IntegralFromFundamental<T>::TValue>{});
-    writeBytes(writer, val);
+    writeVarint(writer, val);
   }
 
   template<typename Reader, typename T>
@@ -81,87 +165,10 @@ private:
   {
     using TUnsigned = SameSizeUnsigned<T>;
     TUnsigned res{};
-    readBytes<Reader::TConfig::CheckDataErrors>(reader, res);
+    readVarint<CheckOverflow && Reader::TConfig::CheckDataErrors>(reader, res);
     v = zigZagDecode<T>(
       res, std::is_signed<typename IntegralFromFundamental<T>::TValue>{});
   }
-
-  // zigzag encode signed types
-  template<typename T>
-  const SameSizeUnsigned<T>& zigZagEncode(const T& v, std::false_type) const
-  {
-    return v;
-  }
-
-  template<typename TResult, typename TUnsigned>
-  const TResult& zigZagDecode(const TUnsigned& v, std::false_type) const
-  {
-    return v;
-  }
-
-  template<typename T>
-  SameSizeUnsigned<T> zigZagEncode(const T& v, std::true_type) const
-  {
-    return static_cast<SameSizeUnsigned<T>>((v << 1) ^
-                                            (v >> (BitsSize<T>::value - 1)));
-  }
-
-  template<typename TResult, typename TUnsigned>
-  TResult zigZagDecode(TUnsigned v, std::true_type) const
-  {
-    return static_cast<TResult>(
-      (v >> 1) ^
-      (~(v & 1) + 1)); // same as -(v & 1), but no warning on VisualStudio
-  }
-
-  // write/read bytes one by one
-  template<typename Writer, typename T>
-  void writeBytes(Writer& w, const T& v) const
-  {
-    using TFast = typename FastType<T>::type;
-    auto val = static_cast<TFast>(v);
-    while (val > 0x7Fu) {
-      w.template writeBytes<1>(static_cast<uint8_t>(val | 0x80u));
-      val >>= 7u;
-    }
-    w.template writeBytes<1>(static_cast<uint8_t>(val));
-  }
-
-  template<bool CheckErrors, typename Reader, typename T>
-  void readBytes(Reader& r, T& v) const
-  {
-    using TFast = typename FastType<T>::type;
-    constexpr auto TBITS = sizeof(T) * 8;
-    uint8_t b1{ 0x80u };
-    auto i = 0u;
-    TFast tmp = {};
-    for (; i < TBITS && b1 > 0x7Fu; i += 7u) {
-      r.template readBytes<1>(b1);
-      tmp += static_cast<TFast>(b1 & 0x7Fu) << i;
-    }
-    v = static_cast<T>(tmp);
-    handleReadOverflow<Reader, T>(r,
-                                  i,
-                                  b1,
-                                  std::integral_constant < bool,
-                                  CheckOverflow&& CheckErrors > {});
-  }
-  template<typename Reader, typename T>
-  void handleReadOverflow(Reader& r,
-                          unsigned shiftedBy,
-                          uint8_t remainder,
-                          std::true_type) const
-  {
-    constexpr auto TBITS = sizeof(T) * 8;
-    if (shiftedBy > TBITS && remainder >> (TBITS + 7 - shiftedBy)) {
-      r.error(bitsery::ReaderError::InvalidData);
-    }
-  }
-
-  template<typename Reader, typename T>
-  void handleReadOverflow(Reader&, unsigned, uint8_t, std::false_type) const
-  {
-  }
 };
 
 }
@@ -24,6 +24,7 @@
 #define BITSERY_EXT_ENTROPY_H
 
 #include "value_range.h"
+#include <unordered_map>
 
 namespace bitsery {
 
@@ -61,26 +62,48 @@ public:
 
   template<typename Ser, typename T, typename Fnc>
   void serialize(Ser& s, const T& obj, Fnc&& fnc) const
+  {
+    serializeWithIndex(
+      s, obj, details::findEntropyIndex(obj, _values), std::forward<Fnc>(fnc));
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& d, T& obj, Fnc&& fnc) const
+  {
+    assert(traits::ContainerTraits<TContainer>::size(_values) > 0);
+    size_t index{};
+    d.ext(index,
+          ext::ValueRange<size_t>{
+            0u, traits::ContainerTraits<TContainer>::size(_values) });
+    deserializeData(d, obj, index, std::forward<Fnc>(fnc));
+  }
+
+protected:
+  // index is 1-based position in values list, or 0 if value is not in list
+  template<typename Ser, typename T, typename Fnc>
+  void serializeWithIndex(Ser& s, const T& obj, size_t index, Fnc&& fnc) const
   {
     assert(traits::ContainerTraits<TContainer>::size(_values) > 0);
-    auto index = details::findEntropyIndex(obj, _values);
     s.ext(index,
           ext::ValueRange<size_t>{
             0u, traits::ContainerTraits<TContainer>::size(_values) });
+    serializeData(s, obj, index, std::forward<Fnc>(fnc));
+  }
+
+  // called after index is written
+  template<typename Ser, typename T, typename Fnc>
+  void serializeData(Ser& s, const T& obj, size_t index, Fnc&& fnc) const
+  {
     if (_alignBeforeData)
       s.adapter().align();
     if (!index)
       fnc(s, const_cast<T&>(obj));
   }
 
+  // called after index is read
   template<typename Des, typename T, typename Fnc>
-  void deserialize(Des& d, T& obj, Fnc&& fnc) const
+  void deserializeData(Des& d, T& obj, size_t index, Fnc&& fnc) const
   {
-    assert(traits::ContainerTraits<TContainer>::size(_values) > 0);
-    size_t index{};
-    d.ext(index,
-          ext::ValueRange<size_t>{
-            0u, traits::ContainerTraits<TContainer>::size(_values) });
     if (_alignBeforeData)
       d.adapter().align();
     if (index) {
@@ -92,10 +115,54 @@ public:
       fnc(d, obj);
   }
 
-private:
   TContainer& _values;
   bool _alignBeforeData;
 };
+
+/*
+ * same encoding as Entropy, but builds hash index of values when
+ * constructed, so that finding value index is O(1) instead of linear scan.
+ * it should be created once and reused, instead of creating it for each call.
+ */
+template<typename TContainer,
+         typename THash = std::hash<
+           typename std::decay<decltype(*std::begin(
+             std::declval<TContainer&>()))>::type>>
+class HashedEntropy : public Entropy<TContainer>
+{
+public:
+  using TValue = typename std::decay<decltype(*std::begin(
+    std::declval<TContainer&>()))>::type;
+
+  explicit HashedEntropy(TContainer& values, bool alignBeforeData = true)
+    : Entropy<TContainer>{ values, alignBeforeData }
+    , _index{}
+  {
+    _index.reserve(traits::ContainerTraits<TContainer>::size(values));
+    size_t index{ 1u };
+    // same as linear scan, first occurrence wins
+    for (auto& v : values)
+      _index.emplace(v, index++);
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& s, const T& obj, Fnc&& fnc) const
+  {
+    this->serializeWithIndex(s, obj, findIndex(obj), std::forward<Fnc>(fnc));
+  }
+
+protected:
+  template<typename T>
+  size_t findIndex(const T& obj) const
+  {
+    auto it = _index.find(static_cast<TValue>(obj));
+    // check again, in case conversion to TValue changed the value
+    return it != _index.end() && it->first == obj ? it->second : 0u;
+  }
+
+private:
+  std::unordered_map<TValue, size_t, THash> _index;
+};
 }
 
 namespace traits {
@@ -107,6 +174,12 @@ struct ExtensionTraits<ext::Entropy<TContainer>, T>
   static constexpr bool SupportObjectOverload = true;
   static constexpr bool SupportLambdaOverload = true;
 };
+
+template<typename TContainer, typename THash, typename T>
+struct ExtensionTraits<ext::HashedEntropy<TContainer, THash>, T>
+  : ExtensionTraits<ext::Entropy<TContainer>, T>
+{
+};
 }
 
 }
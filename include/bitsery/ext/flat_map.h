@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_FLAT_MAP_H
+#define BITSERY_EXT_FLAT_MAP_H
+
+#include "../details/serialization_common.h"
+#include <iterator>
+#include <utility>
+
+namespace bitsery {
+
+namespace ext {
+
+/*
+ * same format as StdMap, but deserializes into sorted flat containers.
+ * map is always serialized in iteration order, so when it is read from sorted
+ * container (e.g. std::map), elements are appended without searching.
+ * container is filled via traits::FlatMapTraits, sorted std::vector of pairs
+ * is supported by <bitsery/traits/vector.h>.
+ * if `verifyOrder` is true, keys are checked to be strictly increasing
+ * according to container's comparator, and InvalidData error is set otherwise.
+ */
+class FlatMap
+{
+public:
+  constexpr explicit FlatMap(size_t maxSize, bool verifyOrder = false)
+    : _maxSize{ maxSize }
+    , _verifyOrder{ verifyOrder }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&& fnc) const
+  {
+    using TKey = typename traits::FlatMapTraits<T>::TKey;
+    using TValue = typename traits::FlatMapTraits<T>::TValue;
+    const auto size =
+      static_cast<size_t>(std::distance(obj.begin(), obj.end()));
+    assert(size <= _maxSize);
+    details::writeSize(ser.adapter(), size);
+
+    for (auto& v : obj)
+      fnc(ser, const_cast<TKey&>(v.first), const_cast<TValue&>(v.second));
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&& fnc) const
+  {
+    using TTraits = traits::FlatMapTraits<T>;
+    using TKey = typename TTraits::TKey;
+    using TValue = typename TTraits::TValue;
+
+    size_t size{};
+    details::readSize(
+      des.adapter(),
+      size,
+      _maxSize,
+      std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
+    TTraits::clear(obj);
+    TTraits::reserve(obj, size);
+
+    const auto less = TTraits::keyComp(obj);
+    for (auto i = 0u; i < size; ++i) {
+      auto key = bitsery::Access::create<TKey>();
+      auto value = bitsery::Access::create<TValue>();
+      fnc(des, key, value);
+      if (_verifyOrder && i > 0 && !less(std::prev(obj.end())->first, key)) {
+        des.adapter().error(ReaderError::InvalidData);
+        return;
+      }
+      TTraits::append(obj, std::move(key), std::move(value));
+    }
+  }
+
+private:
+  size_t _maxSize;
+  bool _verifyOrder;
+};
+}
+
+namespace traits {
+template<typename T>
+struct ExtensionTraits<ext::FlatMap, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = false;
+  static constexpr bool SupportLambdaOverload = true;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_FLAT_MAP_H
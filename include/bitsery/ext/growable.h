@@ -23,6 +23,7 @@
 #ifndef BITSERY_EXT_GROWABLE_H
 #define BITSERY_EXT_GROWABLE_H
 
+#include "../details/adapter_common.h"
 #include "../traits/core/traits.h"
 #include <cstdint>
 
@@ -70,6 +71,20 @@ public:
     reader.currentReadPos(startPos + size);
     reader.currentReadEndPos(readEndPos);
   }
+
+  // jump over serialized object without deserializing it.
+  // only relies on `skipBytes`, so it also works with stream adapters
+  template<typename Des>
+  void skip(Des& des) const
+  {
+    auto& reader = des.adapter();
+    uint32_t size{};
+    reader.template readBytes<4>(size);
+    if (size >= 4u)
+      reader.skipBytes(size - 4u);
+    else
+      reader.error(ReaderError::InvalidData);
+  }
 };
 }
 
@@ -0,0 +1,277 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_HUFFMAN_ENTROPY_H
+#define BITSERY_EXT_HUFFMAN_ENTROPY_H
+
+#include "entropy.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace bitsery {
+
+namespace ext {
+
+/*
+ * same as Entropy, but instead of fixed width index, writes canonical Huffman
+ * code that is built once from frequencies of values.
+ * values that are not in the list are written with escape code (as if
+ * frequency is 1) followed by data.
+ * decoding is table driven: each lookup reads as many bits as the shortest
+ * remaining code has (up to 10), so frequent values are decoded with a single
+ * lookup. bit reader cannot look ahead, so longer codes that share prefix with
+ * shorter ones need more lookups.
+ * it should be created once and reused, and requires bit-packing enabled.
+ */
+template<typename TContainer,
+         typename THash = std::hash<
+           typename std::decay<decltype(*std::begin(
+             std::declval<TContainer&>()))>::type>>
+class HuffmanEntropy : public HashedEntropy<TContainer, THash>
+{
+public:
+  /**
+   * @param values list of most common values
+   * @param frequencies frequency of each value in values list, must have the
+   * same size as values (in release builds extra frequencies are ignored and
+   * missing ones are treated as 1)
+   * @param alignBeforeData aligns after writing code, when false (default)
+   * codes of consecutive values are packed together
+   */
+  template<typename TFrequencies>
+  HuffmanEntropy(TContainer& values,
+                 const TFrequencies& frequencies,
+                 bool alignBeforeData = false)
+    : HashedEntropy<TContainer, THash>{ values, alignBeforeData }
+    , _lengths{}
+    , _codes{}
+    , _nodes{}
+    , _table{}
+  {
+    // symbol 0 is escape code, other symbols are 1-based indexes of values.
+    // frequencies are matched to values by position: extra frequencies are
+    // ignored and missing ones default to 1, so that every index returned by
+    // findIndex has a code even if sizes don't match.
+    const auto symbols = traits::ContainerTraits<TContainer>::size(values) + 1u;
+    std::vector<uint64_t> weights(symbols, 1u);
+    size_t symbol = 1u;
+    for (auto& f : frequencies) {
+      if (symbol < symbols)
+        weights[symbol] = (std::max)(static_cast<uint64_t>(f), uint64_t{ 1u });
+      ++symbol;
+    }
+    assert(symbol == symbols);
+    buildLengths(weights);
+    buildCodes();
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& s, const T& obj, Fnc&& fnc) const
+  {
+    const auto index = this->findIndex(obj);
+    s.adapter().writeBits(_codes[index], _lengths[index]);
+    this->serializeData(s, obj, index, std::forward<Fnc>(fnc));
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& d, T& obj, Fnc&& fnc) const
+  {
+    auto& reader = d.adapter();
+    size_t node{};
+    for (;;) {
+      // read as many bits as the shortest code in this node has left, and
+      // look up either a symbol, or next node for longer codes
+      uint32_t bits{};
+      reader.readBits(bits, _nodes[node].width);
+      const auto entry = _table[_nodes[node].offset + bits];
+      if (entry & 1u) {
+        this->deserializeData(d, obj, entry >> 1u, std::forward<Fnc>(fnc));
+        return;
+      }
+      if (entry == InvalidEntry) {
+        reader.error(ReaderError::InvalidData);
+        return;
+      }
+      node = entry >> 1u;
+    }
+  }
+
+private:
+  static constexpr size_t MaxCodeLength = 32u;
+  // bit reader cannot look ahead, so node can only read bits that every code
+  // in it has, but table size is also limited
+  static constexpr size_t MaxNodeBits = 10u;
+  // decode table entry is: symbol << 1 | 1, next node << 1, or invalid
+  static constexpr uint32_t InvalidEntry = 0u;
+
+  // decode table for codes that starts with the same prefix
+  struct DecodeNode
+  {
+    size_t offset;
+    size_t width;
+  };
+
+  static uint32_t reverseBits(uint32_t v, size_t length)
+  {
+    uint32_t res{};
+    for (size_t i = 0; i < length; ++i, v >>= 1)
+      res = (res << 1) | (v & 1u);
+    return res;
+  }
+
+  void buildLengths(std::vector<uint64_t>& weights)
+  {
+    const auto count = weights.size();
+    _lengths.assign(count, 0u);
+    if (count == 1u) {
+      _lengths[0] = 1u;
+      return;
+    }
+    using TNode = std::pair<uint64_t, size_t>;
+    std::vector<size_t> parents(2u * count - 1u);
+    std::vector<uint8_t> depths(2u * count - 1u);
+    for (;;) {
+      std::priority_queue<TNode, std::vector<TNode>, std::greater<TNode>>
+        queue{};
+      for (size_t i = 0; i < count; ++i)
+        queue.emplace(weights[i], i);
+      auto next = count;
+      while (queue.size() > 1u) {
+        const auto a = queue.top();
+        queue.pop();
+        const auto b = queue.top();
+        queue.pop();
+        parents[a.second] = next;
+        parents[b.second] = next;
+        queue.emplace(a.first + b.first, next++);
+      }
+      // parents always have bigger id than children, root is the last one
+      const auto root = next - 1u;
+      depths[root] = 0u;
+      size_t maxDepth{};
+      for (auto i = root; i-- > 0;) {
+        depths[i] = static_cast<uint8_t>(depths[parents[i]] + 1u);
+        maxDepth = (std::max)(maxDepth, static_cast<size_t>(depths[i]));
+      }
+      if (maxDepth <= MaxCodeLength) {
+        std::copy(depths.begin(),
+                  depths.begin() + static_cast<std::ptrdiff_t>(count),
+                  _lengths.begin());
+        return;
+      }
+      // flatten distribution until codes fit
+      for (auto& w : weights)
+        w = (w >> 1u) | 1u;
+    }
+  }
+
+  void buildCodes()
+  {
+    const auto count = _lengths.size();
+    std::vector<size_t> sortedSymbols(count);
+    for (size_t i = 0; i < count; ++i)
+      sortedSymbols[i] = i;
+    std::stable_sort(sortedSymbols.begin(),
+                     sortedSymbols.end(),
+                     [this](size_t lhs, size_t rhs) {
+                       return _lengths[lhs] < _lengths[rhs];
+                     });
+    size_t lengthCount[MaxCodeLength + 1u]{};
+    for (auto l : _lengths)
+      ++lengthCount[l];
+    uint32_t firstCode[MaxCodeLength + 1u]{};
+    uint32_t code{};
+    for (size_t length = 1; length <= MaxCodeLength; ++length) {
+      code = static_cast<uint32_t>((code + lengthCount[length - 1u]) << 1u);
+      firstCode[length] = code;
+    }
+    _codes.resize(count);
+    _nodes.clear();
+    _table.clear();
+    for (auto symbol : sortedSymbols) {
+      const auto length = _lengths[symbol];
+      const auto symbolCode = firstCode[length]++;
+      // bits are written starting from least significant, so write code
+      // reversed, to read it starting from most significant bit
+      _codes[symbol] = reverseBits(symbolCode, length);
+      addToTable(symbol, _codes[symbol], length);
+    }
+  }
+
+  // symbols are added in order of code length, so the first code that
+  // creates a node is the shortest one in it, and determines node width
+  void addToTable(size_t symbol, uint32_t reversedCode, size_t length)
+  {
+    if (_nodes.empty())
+      addNode(length);
+    size_t node{};
+    size_t depth{};
+    for (;;) {
+      const auto width = _nodes[node].width;
+      const auto bits = (reversedCode >> depth) & ((1u << width) - 1u);
+      auto& entry = _table[_nodes[node].offset + bits];
+      depth += width;
+      if (depth == length) {
+        entry = static_cast<uint32_t>(symbol << 1u) | 1u;
+        return;
+      }
+      if (entry == InvalidEntry) {
+        const auto next = addNode(length - depth);
+        // table might be reallocated
+        _table[_nodes[node].offset + bits] = static_cast<uint32_t>(next << 1u);
+      }
+      node = _table[_nodes[node].offset + bits] >> 1u;
+    }
+  }
+
+  size_t addNode(size_t bitsLeft)
+  {
+    const auto width = bitsLeft < MaxNodeBits ? bitsLeft : MaxNodeBits;
+    _nodes.push_back(DecodeNode{ _table.size(), width });
+    // copy, so that InvalidEntry is not odr-used before c++17
+    const uint32_t invalid = InvalidEntry;
+    _table.resize(_table.size() + (size_t{ 1u } << width), invalid);
+    return _nodes.size() - 1u;
+  }
+
+  std::vector<uint8_t> _lengths;
+  std::vector<uint32_t> _codes;
+  std::vector<DecodeNode> _nodes;
+  std::vector<uint32_t> _table;
+};
+}
+
+namespace traits {
+template<typename TContainer, typename THash, typename T>
+struct ExtensionTraits<ext::HuffmanEntropy<TContainer, THash>, T>
+  : ExtensionTraits<ext::Entropy<TContainer>, T>
+{
+};
+}
+
+}
+
+#endif // BITSERY_EXT_HUFFMAN_ENTROPY_H
@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_INDEXED_OBJECT_H
+#define BITSERY_EXT_INDEXED_OBJECT_H
+
+#include "../details/serialization_common.h"
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#if __cplusplus < 201703L
+#error IndexedObject requires c++17
+// fields are passed as separate lambdas, and without class template argument
+// deduction guides it would be very inconvenient to use
+#endif
+
+namespace bitsery {
+
+namespace ext {
+
+/*
+ * serializes object as a list of separately addressable fields.
+ * each field is provided as a separate lambda, and its position is stored in a
+ * small offset table, so that IndexedObjectAccessor can jump directly to any
+ * field, or skip whole object without deserializing it.
+ * data layout:
+ *  [4b object size][4b fields count][4b offset for each field][fields data...]
+ * offsets and size are relative to the beginning of the object.
+ * same as Growable, it is forward and backward compatible: fields can be
+ * appended at the end, old readers will ignore them, and new readers will
+ * read all 0 for fields that doesn't exist.
+ */
+template<typename... Fields>
+class IndexedObject
+{
+public:
+  static_assert(sizeof...(Fields) > 0, "at least one field is required");
+
+  constexpr explicit IndexedObject(Fields... fields)
+    : _fields{ std::move(fields)... }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    auto& writer = ser.adapter();
+    const auto startPos = writer.currentWritePos();
+    // leave space for header and offset table, it will be written at the end
+    writer.currentWritePos(startPos + HeaderSize);
+
+    uint32_t offsets[FieldsCount]{};
+    serializeFields(ser,
+                    const_cast<T&>(obj),
+                    startPos,
+                    offsets,
+                    std::index_sequence_for<Fields...>{});
+
+    const auto endPos = writer.currentWritePos();
+    writer.currentWritePos(startPos);
+    writer.template writeBytes<4>(static_cast<uint32_t>(endPos - startPos));
+    writer.template writeBytes<4>(static_cast<uint32_t>(FieldsCount));
+    writer.template writeBuffer<4>(offsets, FieldsCount);
+    writer.currentWritePos(endPos);
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    auto& reader = des.adapter();
+    const auto readEndPos = reader.currentReadEndPos();
+    const auto startPos = reader.currentReadPos();
+    uint32_t size{};
+    uint32_t count{};
+    reader.template readBytes<4>(size);
+    reader.template readBytes<4>(count);
+    const auto headerSize = 8u + static_cast<size_t>(count) * 4u;
+    if (size < headerSize) {
+      reader.error(ReaderError::InvalidData);
+      return;
+    }
+    reader.currentReadEndPos(startPos + size);
+    // when reading whole object, fields are read sequentially, so offset table
+    // is not required
+    reader.currentReadPos(startPos + headerSize);
+
+    std::apply([&des, &obj](const auto&... field) { (field(des, obj), ...); },
+               _fields);
+
+    reader.currentReadPos(startPos + size);
+    reader.currentReadEndPos(readEndPos);
+  }
+
+  // jump over serialized object without deserializing it
+  template<typename Des>
+  void skip(Des& des) const
+  {
+    auto& reader = des.adapter();
+    uint32_t size{};
+    reader.template readBytes<4>(size);
+    if (size >= 4u)
+      reader.skipBytes(size - 4u);
+    else
+      reader.error(ReaderError::InvalidData);
+  }
+
+private:
+  static constexpr size_t FieldsCount = sizeof...(Fields);
+  static constexpr size_t HeaderSize = 8u + FieldsCount * 4u;
+
+  template<typename Ser, typename T, size_t... Is>
+  void serializeFields(Ser& ser,
+                       T& obj,
+                       size_t startPos,
+                       uint32_t (&offsets)[FieldsCount],
+                       std::index_sequence<Is...>) const
+  {
+    auto& writer = ser.adapter();
+    ((offsets[Is] =
+        static_cast<uint32_t>(writer.currentWritePos() - startPos),
+      std::get<Is>(_fields)(ser, obj)),
+     ...);
+  }
+
+  std::tuple<Fields...> _fields;
+};
+
+// deduction guide
+template<typename... Fields>
+IndexedObject(Fields...) -> IndexedObject<Fields...>;
+
+/*
+ * lightweight accessor for data serialized with IndexedObject.
+ * it reads only the header of an object, and allows to position reader at the
+ * beginning of any field, or at the end of the object, without decoding
+ * anything else. after calling `field(index)` reader end position is limited
+ * to field data, so the field can be deserialized as usual, nested indexed
+ * objects can be accessed by creating another accessor.
+ * requires adapter that supports read position (e.g. InputBufferAdapter).
+ */
+template<typename Reader>
+class IndexedObjectAccessor
+{
+public:
+  explicit IndexedObjectAccessor(Reader& reader)
+    : _reader{ reader }
+    , _readEndPos{ reader.currentReadEndPos() }
+    , _startPos{ reader.currentReadPos() }
+  {
+    _reader.template readBytes<4>(_size);
+    _reader.template readBytes<4>(_fieldsCount);
+  }
+
+  IndexedObjectAccessor(const IndexedObjectAccessor&) = delete;
+  IndexedObjectAccessor& operator=(const IndexedObjectAccessor&) = delete;
+
+  // number of fields that was written by serializer, it might be different
+  // from the number of fields that current IndexedObject has
+  size_t fieldsCount() const { return _fieldsCount; }
+
+  // position reader at the beginning of a field and limit reader end position
+  // to the end of this field.
+  // returns false if field doesn't exists, or data is invalid.
+  bool field(size_t index)
+  {
+    if (index >= _fieldsCount || _reader.error() != ReaderError::NoError)
+      return false;
+    _reader.currentReadEndPos(_readEndPos);
+    _reader.currentReadPos(_startPos + 8u + index * 4u);
+    uint32_t begin{};
+    uint32_t end{ _size };
+    _reader.template readBytes<4>(begin);
+    if (index + 1 < _fieldsCount)
+      _reader.template readBytes<4>(end);
+    // field data must be after offset table and within object
+    if (begin < 8u + static_cast<size_t>(_fieldsCount) * 4u || begin > end ||
+        end > _size) {
+      _reader.error(ReaderError::InvalidData);
+      return false;
+    }
+    _reader.currentReadPos(_startPos + begin);
+    _reader.currentReadEndPos(_startPos + end);
+    return _reader.error() == ReaderError::NoError;
+  }
+
+  // position reader at the end of the object and restore reader end position,
+  // it must be called when object is no longer accessed.
+  void skip()
+  {
+    _reader.currentReadEndPos(_readEndPos);
+    _reader.currentReadPos(_startPos + _size);
+  }
+
+private:
+  Reader& _reader;
+  size_t _readEndPos;
+  size_t _startPos;
+  uint32_t _size{};
+  uint32_t _fieldsCount{};
+};
+
+}
+
+namespace traits {
+template<typename T, typename... Fields>
+struct ExtensionTraits<ext::IndexedObject<Fields...>, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_INDEXED_OBJECT_H
@@ -25,7 +25,8 @@
 
 #include "../ext/utils/memory_resource.h"
 #include "../traits/core/traits.h"
-#include <unordered_set>
+#include <algorithm>
+#include <vector>
 
 namespace bitsery {
 
@@ -37,7 +38,8 @@ class InheritanceContext
 {
 public:
   explicit InheritanceContext(MemResourceBase* memResource = nullptr)
-    : _virtualBases{ pointer_utils::StdPolyAlloc<const void*>{ memResource } }
+    : _moreVirtualBases{ pointer_utils::StdPolyAlloc<const void*>{
+        memResource } }
   {
   }
   InheritanceContext(const InheritanceContext&) = delete;
@@ -50,8 +52,10 @@ public:
   {
     if (_depth == 0) {
       const void* ptr = std::addressof(derived);
-      if (_parentPtr != ptr)
-        _virtualBases.clear();
+      if (_parentPtr != ptr) {
+        _virtualBasesCount = 0;
+        _moreVirtualBases.clear();
+      }
       _parentPtr = ptr;
     }
     ++_depth;
@@ -61,21 +65,51 @@ public:
   bool beginVirtualBase(const TDerived& derived, const TBase& base)
   {
     beginBase(derived, base);
-    return _virtualBases.emplace(std::addressof(base)).second;
+    return addVirtualBase(std::addressof(base));
   }
 
   void end() { --_depth; }
 
+  // start new message, keeps allocated memory for reuse
+  void clear()
+  {
+    _depth = 0;
+    _parentPtr = nullptr;
+    _virtualBasesCount = 0;
+    _moreVirtualBases.clear();
+  }
+
 private:
-  // these members are required to know when we can clear _virtualBases
+  // objects rarely have more than few virtual bases, so they are stored in
+  // inline array and searched linearly, without allocations or hashing
+  static constexpr size_t InlineVirtualBases = 8;
+
+  bool addVirtualBase(const void* ptr)
+  {
+    const auto inlineEnd =
+      _virtualBases + (_virtualBasesCount < InlineVirtualBases
+                         ? _virtualBasesCount
+                         : InlineVirtualBases);
+    if (std::find(_virtualBases, inlineEnd, ptr) != inlineEnd ||
+        std::find(_moreVirtualBases.begin(), _moreVirtualBases.end(), ptr) !=
+          _moreVirtualBases.end())
+      return false;
+    if (_virtualBasesCount < InlineVirtualBases)
+      _virtualBases[_virtualBasesCount] = ptr;
+    else
+      _moreVirtualBases.push_back(ptr);
+    ++_virtualBasesCount;
+    return true;
+  }
+
+  // these members are required to know when we can clear virtual bases
   size_t _depth{};
   const void* _parentPtr{};
   // add virtual bases to the list, as long as we're on the same parent
-  std::unordered_set<const void*,
-                     std::hash<const void*>,
-                     std::equal_to<const void*>,
-                     pointer_utils::StdPolyAlloc<const void*>>
-    _virtualBases;
+  const void* _virtualBases[InlineVirtualBases]{};
+  size_t _virtualBasesCount{};
+  std::vector<const void*, pointer_utils::StdPolyAlloc<const void*>>
+    _moreVirtualBases;
 };
 
 template<typename TBase>
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_INTERNED_TEXT_H
+#define BITSERY_EXT_INTERNED_TEXT_H
+
+#include "../details/serialization_common.h"
+#include "utils/memory_resource.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bitsery {
+
+namespace ext {
+
+// assigns ids to strings in order of their first appearance.
+// context can be reused for multiple serializers, to keep dictionary for the
+// whole session, in this case deserialization context must be reused in the
+// same way.
+template<typename TString>
+class InternedTextContextSerialization
+{
+public:
+  explicit InternedTextContextSerialization(
+    MemResourceBase* memResource = nullptr)
+    : _ids{ pointer_utils::StdPolyAlloc<std::pair<const TString, size_t>>{
+        memResource } }
+  {
+  }
+
+  InternedTextContextSerialization(const InternedTextContextSerialization&) =
+    delete;
+  InternedTextContextSerialization& operator=(
+    const InternedTextContextSerialization&) = delete;
+  InternedTextContextSerialization(InternedTextContextSerialization&&) =
+    default;
+  InternedTextContextSerialization& operator=(
+    InternedTextContextSerialization&&) = default;
+
+  // returns id and true if string is added to dictionary
+  std::pair<size_t, bool> getId(const TString& str)
+  {
+    auto res = _ids.emplace(str, _ids.size());
+    return { res.first->second, res.second };
+  }
+
+  void clearSerialization() { _ids.clear(); }
+
+private:
+  std::unordered_map<
+    TString,
+    size_t,
+    std::hash<TString>,
+    std::equal_to<TString>,
+    pointer_utils::StdPolyAlloc<std::pair<const TString, size_t>>>
+    _ids;
+};
+
+template<typename TString>
+class InternedTextContextDeserialization
+{
+public:
+  explicit InternedTextContextDeserialization(
+    MemResourceBase* memResource = nullptr)
+    : _strings{ pointer_utils::StdPolyAlloc<TString>{ memResource } }
+  {
+  }
+
+  InternedTextContextDeserialization(
+    const InternedTextContextDeserialization&) = delete;
+  InternedTextContextDeserialization& operator=(
+    const InternedTextContextDeserialization&) = delete;
+  InternedTextContextDeserialization(InternedTextContextDeserialization&&) =
+    default;
+  InternedTextContextDeserialization& operator=(
+    InternedTextContextDeserialization&&) = default;
+
+  size_t size() const { return _strings.size(); }
+
+  const TString& get(size_t id) const { return _strings[id]; }
+
+  void add(const TString& str) { _strings.push_back(str); }
+
+  void clearDeserialization() { _strings.clear(); }
+
+private:
+  std::vector<TString, pointer_utils::StdPolyAlloc<TString>> _strings;
+};
+
+template<typename TString = std::string>
+class InternedTextContext
+  : public InternedTextContextSerialization<TString>
+  , public InternedTextContextDeserialization<TString>
+{
+public:
+  explicit InternedTextContext(MemResourceBase* memResource = nullptr)
+    : InternedTextContextSerialization<TString>(memResource)
+    , InternedTextContextDeserialization<TString>(memResource)
+  {
+  }
+
+  // start new session
+  void clear()
+  {
+    this->clearSerialization();
+    this->clearDeserialization();
+  }
+};
+
+/*
+ * writes text only when it appears for the first time in context, later
+ * occurrences write only its id.
+ * data layout: [size 0][text] for new text, or [size id+1] for existing one.
+ * requires InternedTextContext<T>.
+ */
+class InternedText
+{
+public:
+  constexpr explicit InternedText(size_t maxSize)
+    : _maxSize{ maxSize }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    using TValue = typename traits::ContainerTraits<T>::TValue;
+    auto& ctx = ser.template context<InternedTextContextSerialization<T>>();
+    const auto res = ctx.getId(obj);
+    if (res.second) {
+      details::writeSize(ser.adapter(), 0u);
+      ser.template text<sizeof(TValue)>(obj, _maxSize);
+    } else {
+      details::writeSize(ser.adapter(), res.first + 1u);
+    }
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    using TValue = typename traits::ContainerTraits<T>::TValue;
+    auto& ctx = des.template context<InternedTextContextDeserialization<T>>();
+    size_t ref{};
+    details::readSize(
+      des.adapter(),
+      ref,
+      ctx.size(),
+      std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
+    if (ref == 0u) {
+      des.template text<sizeof(TValue)>(obj, _maxSize);
+      if (des.adapter().error() == ReaderError::NoError)
+        ctx.add(obj);
+    } else if (ref <= ctx.size()) {
+      obj = ctx.get(ref - 1u);
+    }
+  }
+
+private:
+  size_t _maxSize;
+};
+
+}
+
+namespace traits {
+template<typename T>
+struct ExtensionTraits<ext::InternedText, T>
+{
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_INTERNED_TEXT_H
@@ -204,6 +204,94 @@ public:
   }
 };
 
+// same as PointerOwner, but pointed object is not serialized in place:
+// pointer id is written, and object is added to the queue in pointer linking
+// context, which is processed by outermost PointerOwnerIterative in a loop
+// (separately for each nested scope, e.g. enableBitPacking).
+// this way objects are written breadth-first and stack usage doesn't grow with
+// the depth of linked structures (e.g. long lists or deep trees).
+// same pointers must be serialized and deserialized with this extension.
+// only non-polymorphic types with object serialization are supported.
+template<typename RTTI>
+class PointerOwnerIterativeBase
+{
+public:
+  explicit PointerOwnerIterativeBase(
+    PointerType ptrType = PointerType::Nullable)
+    : _ptrType{ ptrType }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    using TElement = typename TManager<T>::TElement;
+    auto ptr = TManager<T>::getPtr(const_cast<T&>(obj));
+    if (ptr) {
+      auto& ctx = ser.template context<
+        pointer_utils::PointerLinkingContextSerialization>();
+      ctx.writeInfoByPtr(ser.adapter(), ptr, PointerOwnershipType::Owner);
+      ctx.processDeferred(ser, &serializeObject<Ser, TElement>, ptr);
+    } else {
+      assert(_ptrType == PointerType::Nullable);
+      details::writeSize(ser.adapter(), 0);
+    }
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    using TElement = typename TManager<T>::TElement;
+    auto& ctx = des.template context<
+      pointer_utils::PointerLinkingContextDeserialization>();
+    const auto id = ctx.readId(des.adapter());
+    if (id) {
+      auto& ptrInfo = ctx.getInfoById(id, PointerOwnershipType::Owner);
+      if (!TManager<T>::getPtr(obj))
+        TManager<T>::create(
+          obj, ctx.getMemResource(), RTTI::template get<TElement>());
+      ptrInfo.processOwner(obj);
+      ctx.processDeferred(des, &deserializeObject<Des, TElement>, obj);
+    } else {
+      if (_ptrType == PointerType::Nullable) {
+        if (TManager<T>::getPtr(obj))
+          TManager<T>::destroy(
+            obj, ctx.getMemResource(), RTTI::template get<TElement>());
+      } else
+        des.adapter().error(ReaderError::InvalidPointer);
+    }
+  }
+
+private:
+  template<typename T>
+  struct TManager : pointer_details::PtrOwnerManager<T>
+  {
+    static_assert(!RTTI::template isPolymorphic<
+                    typename pointer_details::PtrOwnerManager<T>::TElement>(),
+                  "PointerOwnerIterative doesn't support polymorphic types.");
+  };
+
+  template<typename Ser, typename TElement>
+  static void serializeObject(void* ser, void* obj)
+  {
+    static_cast<Ser*>(ser)->object(*static_cast<TElement*>(obj));
+  }
+
+  template<typename Des, typename TElement>
+  static void deserializeObject(void* des, void* obj)
+  {
+    auto& d = *static_cast<Des*>(des);
+    // stop reading when error occurs, remaining objects stay default
+    // constructed
+    if (d.adapter().error() == ReaderError::NoError)
+      d.object(*static_cast<TElement*>(obj));
+  }
+
+  PointerType _ptrType;
+};
+
+using PointerOwnerIterative = PointerOwnerIterativeBase<StandardRTTI>;
+
 }
 
 namespace traits {
@@ -219,6 +307,16 @@ struct ExtensionTraits<ext::PointerOwnerBase<RTTI>, T*>
     !RTTI::template isPolymorphic<TValue>();
 };
 
+template<typename T, typename RTTI>
+struct ExtensionTraits<ext::PointerOwnerIterativeBase<RTTI>, T*>
+{
+  // object is serialized later, so custom lambda cannot be used
+  using TValue = T;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+
 template<typename T>
 struct ExtensionTraits<ext::PointerObserver, T*>
 {
@@ -0,0 +1,162 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_RAW_HASH_TABLE_H
+#define BITSERY_EXT_RAW_HASH_TABLE_H
+
+#include "../details/serialization_common.h"
+#include <cstdint>
+
+namespace bitsery {
+
+namespace traits {
+
+// exposes slot array of open-addressing hash table.
+// must be specialized for each hash table type.
+template<typename T>
+struct RawHashTableTraits
+{
+  // trivially copyable slot type, that contains slot state and element
+  using TSlot = details::NotDefinedType;
+
+  // number of elements in table
+  static size_t size(const T&)
+  {
+    static_assert(std::is_void<T>::value,
+                  "Define RawHashTableTraits to use RawHashTable");
+    return 0u;
+  }
+  // number of slots in table
+  static size_t slotCount(const T&) { return 0u; }
+  // pointer to contiguous array of `slotCount` slots
+  static const TSlot* slots(const T&) { return nullptr; }
+  // allocate `slotCount` slots and return pointer to write them into,
+  // or nullptr if table cannot have this number of slots
+  static TSlot* prepare(T&, size_t) { return nullptr; }
+  // called after slots are written, returns false if table is not valid
+  // (e.g. number of occupied slots doesn't match `size`)
+  static bool finish(T&, size_t) { return false; }
+  // leave table empty, called when data is invalid
+  static void clear(T&) {}
+};
+
+}
+
+namespace ext {
+
+/*
+ * writes slot array of open-addressing hash table directly, so that reading
+ * doesn't need to rehash keys.
+ * slots are written as raw bytes, so this is only allowed when config
+ * endianness matches system endianness, and data should come from trusted
+ * source built with same table layout.
+ */
+class RawHashTable
+{
+public:
+  constexpr explicit RawHashTable(size_t maxSlots)
+    : _maxSlots{ maxSlots }
+  {
+  }
+
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&&) const
+  {
+    using TTraits = traits::RawHashTableTraits<T>;
+    assertRawLayout<typename Ser::TConfig, typename TTraits::TSlot>();
+    const auto slotCount = TTraits::slotCount(obj);
+    assert(slotCount <= _maxSlots);
+    details::writeSize(ser.adapter(), TTraits::size(obj));
+    details::writeSize(ser.adapter(), slotCount);
+    ser.adapter().template writeBuffer<1>(
+      reinterpret_cast<const uint8_t*>(TTraits::slots(obj)),
+      slotCount * sizeof(typename TTraits::TSlot));
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&&) const
+  {
+    using TTraits = traits::RawHashTableTraits<T>;
+    assertRawLayout<typename Des::TConfig, typename TTraits::TSlot>();
+    size_t size{};
+    size_t slotCount{};
+    details::readSize(
+      des.adapter(),
+      size,
+      _maxSlots,
+      std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
+    details::readSize(
+      des.adapter(),
+      slotCount,
+      _maxSlots,
+      std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
+    typename TTraits::TSlot* slots = nullptr;
+    if (size <= slotCount && des.adapter().error() == ReaderError::NoError)
+      slots = TTraits::prepare(obj, slotCount);
+    if (slots == nullptr) {
+      TTraits::clear(obj);
+      des.adapter().error(ReaderError::InvalidData);
+      return;
+    }
+    des.adapter().template readBuffer<1>(
+      reinterpret_cast<uint8_t*>(slots),
+      slotCount * sizeof(typename TTraits::TSlot));
+    if (des.adapter().error() != ReaderError::NoError) {
+      TTraits::clear(obj);
+      return;
+    }
+    if (!TTraits::finish(obj, size)) {
+      TTraits::clear(obj);
+      des.adapter().error(ReaderError::InvalidData);
+    }
+  }
+
+private:
+  template<typename Config, typename TSlot>
+  static void assertRawLayout()
+  {
+    static_assert(std::is_trivially_copyable<TSlot>::value,
+                  "RawHashTable requires trivially copyable slot type");
+    static_assert(Config::Endianness == details::getSystemEndianness(),
+                  "RawHashTable requires config endianness to match system "
+                  "endianness");
+  }
+
+  size_t _maxSlots;
+};
+}
+
+namespace traits {
+template<typename T>
+struct ExtensionTraits<ext::RawHashTable, T>
+{
+  // slots are written directly, so it is used without lambda
+  using TValue = void;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  static constexpr bool SupportLambdaOverload = false;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_RAW_HASH_TABLE_H
@@ -0,0 +1,595 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef BITSERY_EXT_SCHEMA_FINGERPRINT_H
+#define BITSERY_EXT_SCHEMA_FINGERPRINT_H
+
+#include "../details/serialization_common.h"
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace bitsery {
+
+namespace details {
+
+// records the sequence of calls that `serialize` function makes, instead of
+// data. serialize function is visited with default constructed object, for
+// dynamic containers one default constructed element is visited, so that
+// element layout is also part of fingerprint.
+class FingerprintAdapter
+{
+public:
+  using BitPackingEnabled = FingerprintAdapter;
+  using TConfig = DefaultConfig;
+  using TValue = void;
+
+  template<size_t SIZE, typename T>
+  void writeBytes(const T&)
+  {
+    static_assert(std::is_integral<T>(), "");
+    static_assert(sizeof(T) == SIZE, "");
+    token('B', SIZE);
+  }
+
+  template<size_t SIZE, typename T>
+  void writeBuffer(const T*, size_t)
+  {
+    static_assert(std::is_integral<T>(), "");
+    static_assert(sizeof(T) == SIZE, "");
+    token('U', SIZE);
+  }
+
+  template<typename T>
+  void writeBits(const T&, size_t bitsCount)
+  {
+    static_assert(std::is_integral<T>() && std::is_unsigned<T>(), "");
+    token('I', bitsCount);
+  }
+
+  void currentWritePos(size_t pos) { _currPos = pos; }
+
+  size_t currentWritePos() const { return _currPos; }
+
+  void align() { token('A', 0); }
+
+  void flush() {}
+
+  size_t writtenBytesCount() const { return 0; }
+
+  // FNV-1a over token code and its argument
+  void token(char code, uint64_t arg)
+  {
+    hashByte(static_cast<uint8_t>(code));
+    for (auto i = 0u; i < 8u; ++i)
+      hashByte(static_cast<uint8_t>(arg >> (i * 8u)));
+  }
+
+  uint64_t hash() const { return _hash; }
+
+private:
+  void hashByte(uint8_t b)
+  {
+    _hash ^= b;
+    _hash *= 0x100000001b3u;
+  }
+
+  uint64_t _hash{ 0xcbf29ce484222325u };
+  size_t _currPos{};
+};
+
+// unique address per type, used to detect recursive types
+template<typename T>
+struct FingerprintTypeTag
+{
+  static const char id;
+};
+
+template<typename T>
+const char FingerprintTypeTag<T>::id{};
+
+}
+
+// visits serialize function to compute schema fingerprint.
+// it is declared in bitsery namespace, so that brief syntax functions would be
+// found by ADL.
+class FingerprintSerializer
+  : public details::AdapterAndContextRef<details::FingerprintAdapter, void>
+{
+public:
+  using BPEnabledType = FingerprintSerializer;
+  using FixedRegionType = FingerprintSerializer;
+  using TConfig = DefaultConfig;
+
+  FingerprintSerializer()
+    : details::AdapterAndContextRef<details::FingerprintAdapter, void>{}
+  {
+  }
+
+  template<typename T>
+  void object(const T& obj)
+  {
+    procObject(obj, details::IsFundamentalType<T>{});
+  }
+
+  template<typename T, typename Fnc>
+  void object(const T& obj, Fnc&& fnc)
+  {
+    token('F', 0);
+    fnc(*this, const_cast<T&>(obj));
+  }
+
+  template<typename... TArgs>
+  FingerprintSerializer& operator()(TArgs&&... args)
+  {
+    archive(std::forward<TArgs>(args)...);
+    return *this;
+  }
+
+  template<size_t VSIZE, typename T>
+  void value(const T&)
+  {
+    static_assert(details::IsFundamentalType<T>::value,
+                  "Value must be integral, float or enum type.");
+    token('V', VSIZE);
+  }
+
+  template<typename Fnc>
+  void enableBitPacking(Fnc&& fnc)
+  {
+    token('P', 0);
+    fnc(*this);
+  }
+
+  template<typename Fnc>
+  void fixedSizeRegion(size_t size, Fnc&& fnc)
+  {
+    token('Z', size);
+    fnc(*this);
+  }
+
+  template<typename T, typename Ext, typename Fnc>
+  void ext(const T& obj, const Ext& extension, Fnc&& fnc)
+  {
+    static_assert(details::IsExtensionTraitsDefined<Ext, T>::value,
+                  "Please define ExtensionTraits");
+    token('E', 0);
+    extension.serialize(*this, obj, std::forward<Fnc>(fnc));
+  }
+
+  template<size_t VSIZE, typename T, typename Ext>
+  void ext(const T& obj, const Ext& extension)
+  {
+    static_assert(details::IsExtensionTraitsDefined<Ext, T>::value,
+                  "Please define ExtensionTraits");
+    using ExtVType = typename traits::ExtensionTraits<Ext, T>::TValue;
+    using VType = typename std::conditional<std::is_void<ExtVType>::value,
+                                            details::DummyType,
+                                            ExtVType>::type;
+    token('E', VSIZE);
+    extension.serialize(*this, obj, [](FingerprintSerializer& s, VType& v) {
+      s.value<VSIZE>(v);
+    });
+  }
+
+  template<typename T, typename Ext>
+  void ext(const T& obj, const Ext& extension)
+  {
+    static_assert(details::IsExtensionTraitsDefined<Ext, T>::value,
+                  "Please define ExtensionTraits");
+    using ExtVType = typename traits::ExtensionTraits<Ext, T>::TValue;
+    using VType = typename std::conditional<std::is_void<ExtVType>::value,
+                                            details::DummyType,
+                                            ExtVType>::type;
+    token('E', 0);
+    extension.serialize(
+      *this, obj, [](FingerprintSerializer& s, VType& v) { s.object(v); });
+  }
+
+  void boolValue(bool) { token('b', 0); }
+
+  template<size_t VSIZE, typename T>
+  void text(const T&, size_t maxSize)
+  {
+    static_assert(
+      details::IsTextTraitsDefined<T>::value,
+      "Please define TextTraits or include from <bitsery/traits/...>");
+    token('T', VSIZE);
+    token('M', maxSize);
+  }
+
+  template<size_t VSIZE, typename T>
+  void text(const T& str)
+  {
+    static_assert(
+      details::IsTextTraitsDefined<T>::value,
+      "Please define TextTraits or include from <bitsery/traits/...>");
+    token('T', VSIZE);
+    token('N', traits::ContainerTraits<T>::size(str));
+  }
+
+  template<typename T, typename Fnc>
+  void container(const T&, size_t maxSize, Fnc&& fnc)
+  {
+    token('C', 0);
+    token('M', maxSize);
+    typename traits::ContainerTraits<T>::TValue elem{};
+    fnc(*this, elem);
+  }
+
+  template<size_t VSIZE, typename T>
+  void container(const T&, size_t maxSize)
+  {
+    token('C', VSIZE);
+    token('M', maxSize);
+    typename traits::ContainerTraits<T>::TValue elem{};
+    value<VSIZE>(elem);
+  }
+
+  template<typename T>
+  void container(const T&, size_t maxSize)
+  {
+    token('C', 0);
+    token('M', maxSize);
+    typename traits::ContainerTraits<T>::TValue elem{};
+    object(elem);
+  }
+
+  template<
+    typename T,
+    typename Fnc,
+    typename std::enable_if<!std::is_integral<Fnc>::value>::type* = nullptr>
+  void container(const T& obj, Fnc&& fnc)
+  {
+    token('C', 0);
+    token('N', traits::ContainerTraits<T>::size(obj));
+    typename traits::ContainerTraits<T>::TValue elem{};
+    fnc(*this, elem);
+  }
+
+  template<size_t VSIZE, typename T>
+  void container(const T& obj)
+  {
+    token('C', VSIZE);
+    token('N', traits::ContainerTraits<T>::size(obj));
+    typename traits::ContainerTraits<T>::TValue elem{};
+    value<VSIZE>(elem);
+  }
+
+  template<typename T>
+  void container(const T& obj)
+  {
+    token('C', 0);
+    token('N', traits::ContainerTraits<T>::size(obj));
+    typename traits::ContainerTraits<T>::TValue elem{};
+    object(elem);
+  }
+
+  template<typename T>
+  void value1b(T&& v)
+  {
+    value<1>(std::forward<T>(v));
+  }
+
+  template<typename T>
+  void value2b(T&& v)
+  {
+    value<2>(std::forward<T>(v));
+  }
+
+  template<typename T>
+  void value4b(T&& v)
+  {
+    value<4>(std::forward<T>(v));
+  }
+
+  template<typename T>
+  void value8b(T&& v)
+  {
+    value<8>(std::forward<T>(v));
+  }
+
+  template<typename T>
+  void value16b(T&& v)
+  {
+    value<16>(std::forward<T>(v));
+  }
+
+  template<typename T, typename Ext>
+  void ext1b(const T& v, Ext&& extension)
+  {
+    ext<1>(v, std::forward<Ext>(extension));
+  }
+
+  template<typename T, typename Ext>
+  void ext2b(const T& v, Ext&& extension)
+  {
+    ext<2>(v, std::forward<Ext>(extension));
+  }
+
+  template<typename T, typename Ext>
+  void ext4b(const T& v, Ext&& extension)
+  {
+    ext<4>(v, std::forward<Ext>(extension));
+  }
+
+  template<typename T, typename Ext>
+  void ext8b(const T& v, Ext&& extension)
+  {
+    ext<8>(v, std::forward<Ext>(extension));
+  }
+
+  template<typename T, typename Ext>
+  void ext16b(const T& v, Ext&& extension)
+  {
+    ext<16>(v, std::forward<Ext>(extension));
+  }
+
+  template<typename T>
+  void text1b(const T& str, size_t maxSize)
+  {
+    text<1>(str, maxSize);
+  }
+
+  template<typename T>
+  void text2b(const T& str, size_t maxSize)
+  {
+    text<2>(str, maxSize);
+  }
+
+  template<typename T>
+  void text4b(const T& str, size_t maxSize)
+  {
+    text<4>(str, maxSize);
+  }
+
+  template<typename T>
+  void text1b(const T& str)
+  {
+    text<1>(str);
+  }
+
+  template<typename T>
+  void text2b(const T& str)
+  {
+    text<2>(str);
+  }
+
+  template<typename T>
+  void text4b(const T& str)
+  {
+    text<4>(str);
+  }
+
+  template<typename T>
+  void container1b(T&& obj, size_t maxSize)
+  {
+    container<1>(std::forward<T>(obj), maxSize);
+  }
+
+  template<typename T>
+  void container2b(T&& obj, size_t maxSize)
+  {
+    container<2>(std::forward<T>(obj), maxSize);
+  }
+
+  template<typename T>
+  void container4b(T&& obj, size_t maxSize)
+  {
+    container<4>(std::forward<T>(obj), maxSize);
+  }
+
+  template<typename T>
+  void container8b(T&& obj, size_t maxSize)
+  {
+    container<8>(std::forward<T>(obj), maxSize);
+  }
+
+  template<typename T>
+  void container16b(T&& obj, size_t maxSize)
+  {
+    container<16>(std::forward<T>(obj), maxSize);
+  }
+
+  template<typename T>
+  void container1b(T&& obj)
+  {
+    container<1>(std::forward<T>(obj));
+  }
+
+  template<typename T>
+  void container2b(T&& obj)
+  {
+    container<2>(std::forward<T>(obj));
+  }
+
+  template<typename T>
+  void container4b(T&& obj)
+  {
+    container<4>(std::forward<T>(obj));
+  }
+
+  template<typename T>
+  void container8b(T&& obj)
+  {
+    container<8>(std::forward<T>(obj));
+  }
+
+  template<typename T>
+  void container16b(T&& obj)
+  {
+    container<16>(std::forward<T>(obj));
+  }
+
+  uint64_t hash() const { return _adapter.hash(); }
+
+private:
+  void token(char code, uint64_t arg) { _adapter.token(code, arg); }
+
+  // fundamental types via brief syntax, same as value<N>
+  template<typename T>
+  void procObject(const T& obj, std::true_type)
+  {
+    details::SerializeFunction<FingerprintSerializer, T>::invoke(
+      *this, const_cast<T&>(obj));
+  }
+
+  template<typename T>
+  void procObject(const T& obj, std::false_type)
+  {
+    const void* tag = &details::FingerprintTypeTag<T>::id;
+    for (auto it = _visiting.rbegin(); it != _visiting.rend(); ++it) {
+      if (*it == tag) {
+        // recursive type, record distance instead of visiting again
+        const auto depth = std::distance(_visiting.rbegin(), it);
+        token('R', static_cast<uint64_t>(depth));
+        return;
+      }
+    }
+    token('O', 0);
+    _visiting.push_back(tag);
+    details::SerializeFunction<FingerprintSerializer, T>::invoke(
+      *this, const_cast<T&>(obj));
+    _visiting.pop_back();
+    token('o', 0);
+  }
+
+  // these are dummy functions for extensions that have TValue = void
+  void object(details::DummyType&) {}
+
+  template<size_t VSIZE>
+  void value(details::DummyType&)
+  {
+  }
+
+  template<typename T, typename... TArgs>
+  void archive(T&& head, TArgs&&... tail)
+  {
+    details::BriefSyntaxFunction<FingerprintSerializer, T>::invoke(
+      *this, std::forward<T>(head));
+    archive(std::forward<TArgs>(tail)...);
+  }
+
+  void archive() {}
+
+  std::vector<const void*> _visiting{};
+};
+
+namespace details {
+
+template<typename T>
+uint64_t
+computeSchemaFingerprint()
+{
+  static_assert(std::is_default_constructible<T>::value,
+                "schema fingerprint requires default constructible type");
+  FingerprintSerializer ser{};
+  T obj{};
+  ser.object(obj);
+  return ser.hash();
+}
+
+}
+
+namespace ext {
+
+/*
+ * returns 64bit hash, computed from sequence of calls that `serialize`
+ * function makes for type T, e.g. value<N>, text, container, object, ext.
+ * it doesn't depend on data, so it can be used to detect schema mismatch
+ * before decoding.
+ * it is not constexpr: serialize function is visited at runtime, the first time
+ * fingerprint is requested, and result is cached in function-local static, so
+ * later calls are a single load.
+ * limitations:
+ * * T must be default constructible and serialize function must be a template
+ *   (it is visited with special serializer);
+ * * extensions are visited with default constructed object, so e.g. elements
+ *   of std::map are not part of fingerprint;
+ * * extensions that require context (e.g. pointers) are not supported.
+ */
+template<typename T>
+uint64_t
+schemaFingerprint()
+{
+  static const uint64_t fingerprint = details::computeSchemaFingerprint<T>();
+  return fingerprint;
+}
+
+/*
+ * writes schema fingerprint of T (8 bytes) before object data.
+ * during deserialization, when fingerprint doesn't match, object is not
+ * deserialized and ReaderError::InvalidData is set.
+ */
+class SchemaFingerprint
+{
+public:
+  template<typename Ser, typename T, typename Fnc>
+  void serialize(Ser& ser, const T& obj, Fnc&& fnc) const
+  {
+    ser.value8b(fingerprintOf<T>(ser));
+    fnc(ser, const_cast<T&>(obj));
+  }
+
+  template<typename Des, typename T, typename Fnc>
+  void deserialize(Des& des, T& obj, Fnc&& fnc) const
+  {
+    uint64_t fingerprint{};
+    des.value8b(fingerprint);
+    if (fingerprint == schemaFingerprint<T>())
+      fnc(des, obj);
+    else
+      des.adapter().error(ReaderError::InvalidData);
+  }
+
+private:
+  template<typename T, typename Ser>
+  static uint64_t fingerprintOf(Ser&)
+  {
+    return schemaFingerprint<T>();
+  }
+
+  // nested fingerprint while computing fingerprint, don't query cached value
+  // because it might be the same type that is currently being computed.
+  template<typename T>
+  static uint64_t fingerprintOf(FingerprintSerializer&)
+  {
+    return 0;
+  }
+};
+}
+
+namespace traits {
+template<typename T>
+struct ExtensionTraits<ext::SchemaFingerprint, T>
+{
+  using TValue = T;
+  static constexpr bool SupportValueOverload = false;
+  static constexpr bool SupportObjectOverload = true;
+  // fingerprint is computed from object's serialize function
+  static constexpr bool SupportLambdaOverload = false;
+};
+}
+
+}
+
+#endif // BITSERY_EXT_SCHEMA_FINGERPRINT_H
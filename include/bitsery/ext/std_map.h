@@ -25,7 +25,7 @@
 
 #include "../details/serialization_common.h"
 #include "../traits/core/traits.h"
-// we need this, so we could reserve for non ordered map
+// kept for backward compatibility, users may rely on it being included
 #include <unordered_map>
 
 namespace bitsery {
@@ -39,6 +39,18 @@ public:
   {
   }
 
+#if __cplusplus >= 201703L
+  // when `reuseNodes` is true, nodes of existing container are extracted and
+  // deserialized into, so that deserializing into container of same size
+  // doesn't allocate nodes (unordered containers still allocate new bucket
+  // array). ignored for containers without node handles.
+  constexpr StdMap(size_t maxSize, bool reuseNodes)
+    : _maxSize{ maxSize }
+    , _reuseNodes{ reuseNodes }
+  {
+  }
+#endif
+
   template<typename Ser, typename T, typename Fnc>
   void serialize(Ser& ser, const T& obj, Fnc&& fnc) const
   {
@@ -64,45 +76,58 @@ public:
       size,
       _maxSize,
       std::integral_constant<bool, Des::TConfig::CheckDataErrors>{});
-    obj.clear();
-    reserve(obj, size);
+#if __cplusplus >= 201703L
+    if constexpr (details::HasNodeHandle<T>::value) {
+      if (_reuseNodes) {
+        deserializeReusingNodes(des, obj, fnc, size);
+        return;
+      }
+    }
+#endif
+    using TTraits = traits::AssociativeContainerTraits<T>;
+    TTraits::clear(obj);
+    TTraits::reserve(obj, size);
 
     auto hint = obj.begin();
     for (auto i = 0u; i < size; ++i) {
       auto key = bitsery::Access::create<TKey>();
       auto value = bitsery::Access::create<TValue>();
       fnc(des, key, value);
-      hint = obj.emplace_hint(hint, std::move(key), std::move(value));
+      hint = TTraits::emplace(obj, hint, std::move(key), std::move(value));
     }
   }
 
 private:
-  template<typename Key,
-           typename T,
-           typename Hash,
-           typename KeyEqual,
-           typename Allocator>
-  void reserve(std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& obj,
-               size_t size) const
-  {
-    obj.reserve(size);
-  }
-  template<typename Key,
-           typename T,
-           typename Hash,
-           typename KeyEqual,
-           typename Allocator>
-  void reserve(std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator>& obj,
-               size_t size) const
-  {
-    obj.reserve(size);
-  }
-  template<typename T>
-  void reserve(T&, size_t) const
+#if __cplusplus >= 201703L
+  template<typename Des, typename T, typename Fnc>
+  void deserializeReusingNodes(Des& des, T& obj, Fnc& fnc, size_t size) const
   {
-    // for ordered container do nothing
+    using TKey = typename T::key_type;
+    using TValue = typename T::mapped_type;
+
+    // nodes container has the same comparator (or hash) and allocator, so
+    // they are preserved, and swap is valid for stateful allocators.
+    // unordered containers still allocate new bucket array
+    auto nodes = details::createEmptyLike(obj, 0);
+    nodes.swap(obj);
+    traits::AssociativeContainerTraits<T>::reserve(obj, size);
+    for (auto i = 0u; i < size; ++i) {
+      if (!nodes.empty()) {
+        auto node = nodes.extract(nodes.begin());
+        fnc(des, node.key(), node.mapped());
+        obj.insert(obj.end(), std::move(node));
+      } else {
+        auto key = bitsery::Access::create<TKey>();
+        auto value = bitsery::Access::create<TValue>();
+        fnc(des, key, value);
+        obj.emplace_hint(obj.end(), std::move(key), std::move(value));
+      }
+    }
   }
+#endif
+
   size_t _maxSize;
+  bool _reuseNodes{ false };
 };
 }
 
@@ -140,12 +140,7 @@ struct SmartPtrOwnerManager
                            MemResourceBase* memResource,
                            size_t typeId)
   {
-    // capture deleter parameters by value
-    pointer_utils::PolyAllocWithTypeId alloc{ memResource };
-    obj.reset(
-      alloc.newObject<TElement>(typeId),
-      [alloc, typeId](TElement* data) { alloc.deleteObject(data, typeId); },
-      pointer_utils::StdPolyAlloc<TElement>(memResource));
+    obj = makeShared(memResource, typeId);
     state.obj = obj;
   }
 
@@ -155,12 +150,7 @@ struct SmartPtrOwnerManager
     MemResourceBase* memResource,
     const std::shared_ptr<PolymorphicHandlerBase>& handler)
   {
-    // capture deleter parameters by value
-    pointer_utils::PolyAllocWithTypeId alloc{ memResource };
-    obj.reset(
-      static_cast<TElement*>(handler->create(alloc)),
-      [alloc, handler](TElement* data) { handler->destroy(alloc, data); },
-      pointer_utils::StdPolyAlloc<TElement>(memResource));
+    obj = makeSharedPolymorphic(memResource, handler);
     state.obj = obj;
   }
 
@@ -169,11 +159,7 @@ struct SmartPtrOwnerManager
                            MemResourceBase* memResource,
                            size_t typeId)
   {
-    pointer_utils::PolyAllocWithTypeId alloc{ memResource };
-    std::shared_ptr<TElement> res(
-      alloc.newObject<TElement>(typeId),
-      [alloc, typeId](TElement* data) { alloc.deleteObject(data, typeId); },
-      pointer_utils::StdPolyAlloc<TElement>(memResource));
+    auto res = makeShared(memResource, typeId);
     obj = res;
     state.obj = res;
   }
@@ -184,11 +170,7 @@ struct SmartPtrOwnerManager
     MemResourceBase* memResource,
     const std::shared_ptr<PolymorphicHandlerBase>& handler)
   {
-    pointer_utils::PolyAllocWithTypeId alloc{ memResource };
-    std::shared_ptr<TElement> res(
-      static_cast<TElement*>(handler->create(alloc)),
-      [alloc, handler](TElement* data) { handler->destroy(alloc, data); },
-      pointer_utils::StdPolyAlloc<TElement>(memResource));
+    auto res = makeSharedPolymorphic(memResource, handler);
     obj = res;
     state.obj = res;
   }
@@ -198,11 +180,27 @@ struct SmartPtrOwnerManager
     state.obj = std::shared_ptr<TElement>(obj);
   }
 
-  static void loadFromSharedState(TSharedState& state, T& obj)
+  // ptr is object from shared state, converted to TElement
+  static void loadFromSharedState(TSharedState& state, T& obj, TElement* ptr)
   {
-    // reinterpret_pointer_cast is only since c++17
-    auto p = reinterpret_cast<TElement*>(state.obj.get());
-    obj = std::shared_ptr<TElement>(state.obj, p);
+    obj = std::shared_ptr<TElement>(state.obj, ptr);
+  }
+
+private:
+  // object and control block are allocated together, like std::allocate_shared
+  static std::shared_ptr<TElement> makeShared(MemResourceBase* memResource,
+                                              size_t typeId)
+  {
+    return std::allocate_shared<TElement>(
+      pointer_utils::StdPolyAllocWithTypeId<TElement>{ memResource, typeId });
+  }
+
+  static std::shared_ptr<TElement> makeSharedPolymorphic(
+    MemResourceBase* memResource,
+    const std::shared_ptr<PolymorphicHandlerBase>& handler)
+  {
+    auto res = handler->createShared(memResource);
+    return std::shared_ptr<TElement>(res, static_cast<TElement*>(res.get()));
   }
 };
 }
@@ -24,7 +24,11 @@
 #define BITSERY_EXT_MEMORY_RESOURCE_H
 
 #include "../../details/serialization_common.h"
+#include <cstddef>
+#include <cstdint>
 #include <new>
+#include <unordered_map>
+#include <vector>
 
 namespace bitsery {
 namespace ext {
@@ -189,7 +193,201 @@ private:
   PolyAllocWithTypeId _alloc;
 };
 
+// allocator for std::allocate_shared, so that object and shared_ptr control
+// block are allocated together, using typeId of the object.
+// object is created via Access, so it can have private default constructor
+template<class T>
+class StdPolyAllocWithTypeId
+{
+public:
+  using value_type = T;
+
+  constexpr StdPolyAllocWithTypeId(PolyAllocWithTypeId alloc, size_t typeId)
+    : _alloc{ alloc }
+    , _typeId{ typeId }
+  {
+  }
+
+  template<typename U>
+  friend class StdPolyAllocWithTypeId;
+
+  template<class U>
+  constexpr explicit StdPolyAllocWithTypeId(
+    const StdPolyAllocWithTypeId<U>& other) noexcept
+    : _alloc{ other._alloc }
+    , _typeId{ other._typeId }
+  {
+  }
+
+  T* allocate(std::size_t n) { return _alloc.allocate<T>(n, _typeId); }
+
+  void deallocate(T* p, std::size_t n) noexcept
+  {
+    return _alloc.deallocate(p, n, _typeId);
+  }
+
+  template<class U>
+  void construct(U* p)
+  {
+    ::bitsery::Access::create<U>(p);
+  }
+
+  template<class U>
+  friend bool operator==(const StdPolyAllocWithTypeId<T>& lhs,
+                         const StdPolyAllocWithTypeId<U>& rhs) noexcept
+  {
+    return lhs._alloc == rhs._alloc && lhs._typeId == rhs._typeId;
+  }
+
+  template<class U>
+  friend bool operator!=(const StdPolyAllocWithTypeId<T>& lhs,
+                         const StdPolyAllocWithTypeId<U>& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  PolyAllocWithTypeId _alloc;
+  size_t _typeId;
+};
+
 }
+
+// memory resource that allocates objects from contiguous memory blocks
+// (slabs), separate for each type id, so objects of the same type are stored
+// next to each other and allocation is just a pointer increment.
+// deallocation does nothing, all memory is freed at once when resource is
+// destroyed or release() is called, so it must outlive allocated objects.
+// allocations with typeId 0 (internal data of contexts) are forwarded to
+// upstream resource. TypeIdRTTI returns 0 for types without
+// PolymorphicTypeId<T>, so specialize it for non-polymorphic types as well.
+class MemResourceSlab final : public MemResourceBase
+{
+public:
+  explicit MemResourceSlab(size_t blockSize = 4096,
+                           MemResourceBase* upstream = nullptr)
+    : _blockSize{ blockSize }
+    , _upstream{ upstream }
+    , _slabs{ pointer_utils::StdPolyAlloc<std::pair<const size_t, Slab>>{
+        upstream } }
+    , _blocks{ pointer_utils::StdPolyAlloc<Block>{ upstream } }
+  {
+  }
+
+  MemResourceSlab(const MemResourceSlab&) = delete;
+  MemResourceSlab& operator=(const MemResourceSlab&) = delete;
+
+  ~MemResourceSlab() noexcept final { release(); }
+
+  // makes sure that next allocations of typeId, up to specified bytes, are
+  // stored contiguously, e.g. when number of objects is known from header
+  void reserve(size_t bytes, size_t alignment, size_t typeId)
+  {
+    auto& slab = _slabs[typeId];
+    if (!alignedPtr(slab, bytes, alignment))
+      newBlock(slab, bytes + alignment - 1);
+  }
+
+  // reserves `count` * sizeof(T), it only covers objects that are allocated
+  // alone (raw pointers and std::unique_ptr). std::shared_ptr objects are
+  // allocated together with control block, so their allocation is bigger than
+  // T and reserved memory is not enough for `count` of them.
+  template<typename T>
+  void reserveObjects(size_t count, size_t typeId)
+  {
+    reserve(sizeof(T) * count, std::alignment_of<T>::value, typeId);
+  }
+
+  void* allocate(size_t bytes, size_t alignment, size_t typeId) final
+  {
+    if (typeId == 0)
+      return upstream().allocate(bytes, alignment, typeId);
+    auto& slab = _slabs[typeId];
+    auto ptr = alignedPtr(slab, bytes, alignment);
+    if (!ptr) {
+      const auto size = bytes + alignment - 1;
+      newBlock(slab, size > _blockSize ? size : _blockSize);
+      ptr = alignedPtr(slab, bytes, alignment);
+    }
+    slab.cur = ptr + bytes;
+    return ptr;
+  }
+
+  void deallocate(void* ptr,
+                  size_t bytes,
+                  size_t alignment,
+                  size_t typeId) noexcept final
+  {
+    if (typeId == 0)
+      upstream().deallocate(ptr, bytes, alignment, typeId);
+  }
+
+  // frees all slabs, objects allocated from them must be already destroyed
+  // (or be trivially destructible)
+  void release() noexcept
+  {
+    for (auto& block : _blocks)
+      upstream().deallocate(block.ptr, block.size, BlockAlignment, 0);
+    _blocks.clear();
+    _slabs.clear();
+  }
+
+private:
+  static constexpr size_t BlockAlignment =
+    std::alignment_of<std::max_align_t>::value;
+
+  struct Slab
+  {
+    char* cur{};
+    char* end{};
+  };
+
+  struct Block
+  {
+    char* ptr;
+    size_t size;
+  };
+
+  MemResourceBase& upstream() noexcept
+  {
+    return _upstream ? *_upstream : _newDelete;
+  }
+
+  static char* alignedPtr(const Slab& slab, size_t bytes, size_t alignment)
+  {
+    if (!slab.cur)
+      return nullptr;
+    const auto addr = reinterpret_cast<std::uintptr_t>(slab.cur);
+    const auto aligned = (addr + alignment - 1) & ~(alignment - 1);
+    if (aligned + bytes > reinterpret_cast<std::uintptr_t>(slab.end))
+      return nullptr;
+    return slab.cur + (aligned - addr);
+  }
+
+  void newBlock(Slab& slab, size_t size)
+  {
+    // reserve before allocating, so that block is not leaked if it throws
+    if (_blocks.size() == _blocks.capacity())
+      _blocks.reserve(_blocks.size() * 2 + 1);
+    auto ptr =
+      static_cast<char*>(upstream().allocate(size, BlockAlignment, 0));
+    _blocks.push_back(Block{ ptr, size });
+    slab.cur = ptr;
+    slab.end = ptr + size;
+  }
+
+  size_t _blockSize;
+  MemResourceBase* _upstream;
+  MemResourceNewDelete _newDelete{};
+  std::unordered_map<size_t,
+                     Slab,
+                     std::hash<size_t>,
+                     std::equal_to<size_t>,
+                     pointer_utils::StdPolyAlloc<std::pair<const size_t, Slab>>>
+    _slabs;
+  std::vector<Block, pointer_utils::StdPolyAlloc<Block>> _blocks;
+};
+
 }
 
 }
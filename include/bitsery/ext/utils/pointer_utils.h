@@ -23,7 +23,10 @@
 #ifndef BITSERY_POINTER_UTILS_H
 #define BITSERY_POINTER_UTILS_H
 
+#include "../compact_value.h"
 #include "polymorphism_utils.h"
+#include <cstddef>
+#include <deque>
 
 namespace bitsery {
 namespace ext {
@@ -35,6 +38,16 @@ enum class PointerType : uint8_t
   NotNull
 };
 
+// Absolute - pointer id is written as size.
+// Relative - pointer id is written as varint distance from the next new id,
+// so that new objects and references to recently created objects take one
+// byte. Serializer and deserializer must use same encoding.
+enum class PointerIdEncoding : uint8_t
+{
+  Absolute,
+  Relative
+};
+
 // Observer - not responsible for pointer lifetime management.
 // Owner - only ONE owner is responsible for this pointers creation/destruction
 // SharedOwner, SharedObserver - MANY shared owners is responsible for pointer
@@ -59,20 +72,118 @@ struct PointerSharedStateBase
   virtual ~PointerSharedStateBase() = default;
 };
 
-struct PointerSharedStateDeleter
+// stores shared state of one pointer id.
+// state is constructed inline when it fits, so that deserializing shared
+// pointers doesn't require separate allocation for each of them
+class PointerSharedStateStorage
 {
-  PointerSharedStateDeleter() = default;
-  explicit PointerSharedStateDeleter(MemResourceBase* memResource)
-    : _memResource{ memResource }
+public:
+  PointerSharedStateStorage() = default;
+
+  PointerSharedStateStorage(const PointerSharedStateStorage&) = delete;
+
+  PointerSharedStateStorage& operator=(const PointerSharedStateStorage&) =
+    delete;
+
+  PointerSharedStateStorage(PointerSharedStateStorage&& other) noexcept
   {
+    moveFrom(other);
   }
-  void operator()(PointerSharedStateBase* data) const
+
+  PointerSharedStateStorage& operator=(
+    PointerSharedStateStorage&& other) noexcept
   {
-    data->~PointerSharedStateBase();
-    StdPolyAlloc<PointerSharedStateBase> alloc{ _memResource };
-    alloc.deallocate(data, 1);
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  ~PointerSharedStateStorage() { reset(); }
+
+  template<typename T>
+  T& emplace(MemResourceBase* memResource)
+  {
+    static_assert(std::is_base_of<PointerSharedStateBase, T>::value,
+                  "shared state must derive from PointerSharedStateBase");
+    reset();
+    return emplaceImpl<T>(memResource, FitsInline<T>{});
+  }
+
+  void reset() noexcept
+  {
+    if (_state) {
+      _destroy(*this);
+      _state = nullptr;
+    }
+  }
+
+  PointerSharedStateBase* get() const noexcept { return _state; }
+
+  explicit operator bool() const noexcept { return _state != nullptr; }
+
+private:
+  static constexpr size_t InlineSize = 4 * sizeof(void*);
+
+  template<typename T>
+  using FitsInline = std::integral_constant<
+    bool,
+    sizeof(T) <= InlineSize &&
+      alignof(T) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible<T>::value>;
+
+  template<typename T>
+  T& emplaceImpl(MemResourceBase*, std::true_type)
+  {
+    auto* obj = new (_buffer) T{};
+    _state = obj;
+    _move = [](PointerSharedStateStorage& dst, PointerSharedStateStorage& src) {
+      auto& srcObj = static_cast<T&>(*src._state);
+      dst._state = new (dst._buffer) T{ std::move(srcObj) };
+      srcObj.~T();
+    };
+    _destroy = [](PointerSharedStateStorage& self) {
+      static_cast<T*>(self._state)->~T();
+    };
+    return *obj;
+  }
+
+  template<typename T>
+  T& emplaceImpl(MemResourceBase* memResource, std::false_type)
+  {
+    StdPolyAlloc<T> alloc{ memResource };
+    auto* obj = new (alloc.allocate(1)) T{};
+    _state = obj;
+    _memResource = memResource;
+    _move = [](PointerSharedStateStorage& dst, PointerSharedStateStorage& src) {
+      dst._state = src._state;
+      dst._memResource = src._memResource;
+    };
+    _destroy = [](PointerSharedStateStorage& self) {
+      auto* ptr = static_cast<T*>(self._state);
+      ptr->~T();
+      StdPolyAlloc<T>{ self._memResource }.deallocate(ptr, 1);
+    };
+    return *obj;
   }
+
+  void moveFrom(PointerSharedStateStorage& other) noexcept
+  {
+    if (other._state) {
+      other._move(*this, other);
+      _move = other._move;
+      _destroy = other._destroy;
+      other._state = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char _buffer[InlineSize]{};
+  PointerSharedStateBase* _state = nullptr;
   MemResourceBase* _memResource = nullptr;
+  void (*_move)(PointerSharedStateStorage&,
+                PointerSharedStateStorage&) = nullptr;
+  void (*_destroy)(PointerSharedStateStorage&) = nullptr;
 };
 
 // PLC info is internal classes for serializer, and deserializer
@@ -157,22 +268,105 @@ struct PLCInfoDeserializer : PLCInfo
   }
 
   void* ownerPtr;
+  // most derived object and its type, set for polymorphic shared objects
+  void* mostDerivedPtr{};
+  size_t mostDerivedTypeId{};
   MemResourceBase* memResource;
   std::vector<std::reference_wrapper<void*>,
               StdPolyAlloc<std::reference_wrapper<void*>>>
     observersList;
-  std::unique_ptr<PointerSharedStateBase, PointerSharedStateDeleter>
-    sharedState{};
+  PointerSharedStateStorage sharedState{};
+};
+
+// objects which content is (de)serialized later, so that linked structures
+// (e.g. long lists, deep trees) are processed iteratively, breadth-first,
+// instead of recursively.
+class DeferredObjectsQueue
+{
+public:
+  using TProcessFnc = void (*)(void* s, void* obj);
+
+  explicit DeferredObjectsQueue(MemResourceBase* memResource = nullptr)
+    : _queue{ StdPolyAlloc<Item>{ memResource } }
+  {
+  }
+
+  DeferredObjectsQueue(const DeferredObjectsQueue&) = delete;
+  DeferredObjectsQueue& operator=(const DeferredObjectsQueue&) = delete;
+  DeferredObjectsQueue(DeferredObjectsQueue&&) = default;
+  DeferredObjectsQueue& operator=(DeferredObjectsQueue&&) = default;
+
+  // adds object to the queue, and if queue is not being processed by `s`,
+  // processes it until it is empty. objects added while processing are
+  // processed by the same loop, so stack usage doesn't depend on the depth of
+  // structure.
+  // nested scope (e.g. enableBitPacking) has different (de)serializer, so it
+  // processes its own objects before scope ends, and `fnc` is always invoked
+  // with (de)serializer that added the object.
+  template<typename S>
+  void process(S& s, TProcessFnc fnc, void* obj)
+  {
+    _queue.push_back(Item{ fnc, obj });
+    if (_processing == static_cast<void*>(&s))
+      return;
+    const auto prevProcessing = _processing;
+    _processing = &s;
+    const auto begin = _queue.size() - 1u;
+    auto head = begin;
+    while (head < _queue.size()) {
+      const auto item = _queue[head++];
+      item.fnc(&s, item.obj);
+      // remove processed objects, when it is not more expensive than
+      // processing them, so memory doesn't grow with number of objects
+      if (head - begin >= _queue.size() - head) {
+        _queue.erase(_queue.begin() + static_cast<std::ptrdiff_t>(begin),
+                     _queue.begin() + static_cast<std::ptrdiff_t>(head));
+        head = begin;
+      }
+    }
+    _processing = prevProcessing;
+  }
+
+  // removes objects left when exception was thrown while processing
+  void clear()
+  {
+    _queue.clear();
+    _processing = nullptr;
+  }
+
+private:
+  struct Item
+  {
+    TProcessFnc fnc;
+    void* obj;
+  };
+
+  std::vector<Item, StdPolyAlloc<Item>> _queue;
+  // (de)serializer whose loop is processing the end of the queue
+  void* _processing{};
 };
 
 class PointerLinkingContextSerialization
 {
+  using TPtrMap =
+    std::unordered_map<const void*,
+                       size_t,
+                       std::hash<const void*>,
+                       std::equal_to<const void*>,
+                       StdPolyAlloc<std::pair<const void* const, size_t>>>;
+
 public:
   explicit PointerLinkingContextSerialization(
-    MemResourceBase* memResource = nullptr)
+    MemResourceBase* memResource = nullptr,
+    PointerIdEncoding idEncoding = PointerIdEncoding::Absolute)
     : _currId{ 0 }
-    , _ptrMap{ StdPolyAlloc<std::pair<const void* const, PLCInfoSerializer>>{
+    , _idEncoding{ idEncoding }
+    , _infos{ StdPolyAlloc<PLCInfoSerializer>{ memResource } }
+    , _ptrMap{ StdPolyAlloc<std::pair<const void* const, size_t>>{
         memResource } }
+    , _mostDerivedMap{ StdPolyAlloc<std::pair<const void* const, size_t>>{
+        memResource } }
+    , _deferredObjects{ memResource }
   {
   }
 
@@ -190,51 +384,103 @@ public:
 
   ~PointerLinkingContextSerialization() = default;
 
+  // mostDerivedPtr is address of most derived object, if it is known.
+  // objects are tracked by it, so that same object gets the same id when it is
+  // referenced via pointers to different base classes.
+  // otherwise object is tracked by the address it was first referenced with.
   const PLCInfoSerializer& getInfoByPtr(const void* ptr,
-                                        PointerOwnershipType ptrType)
-  {
-    auto res = _ptrMap.emplace(ptr, PLCInfoSerializer{ _currId + 1u, ptrType });
-    auto& ptrInfo = res.first->second;
-    if (res.second) {
-      ++_currId;
-      return ptrInfo;
+                                        PointerOwnershipType ptrType,
+                                        const void* mostDerivedPtr = nullptr)
+  {
+    if (mostDerivedPtr) {
+      auto it = _mostDerivedMap.find(mostDerivedPtr);
+      if (it != _mostDerivedMap.end()) {
+        auto& info = _infos[it->second];
+        info.update(ptrType);
+        return info;
+      }
     }
-    ptrInfo.update(ptrType);
+    auto res = _ptrMap.emplace(ptr, _infos.size());
+    const auto index = res.first->second;
+    if (res.second)
+      _infos.emplace_back(++_currId, ptrType);
+    else
+      _infos[index].update(ptrType);
+    if (mostDerivedPtr)
+      _mostDerivedMap.emplace(mostDerivedPtr, index);
+    return _infos[index];
+  }
+
+  // same as getInfoByPtr, but also writes pointer id
+  template<typename Writer>
+  const PLCInfoSerializer& writeInfoByPtr(Writer& writer,
+                                          const void* ptr,
+                                          PointerOwnershipType ptrType,
+                                          const void* mostDerivedPtr = nullptr)
+  {
+    const auto nextId = _currId + 1u;
+    auto& ptrInfo = getInfoByPtr(ptr, ptrType, mostDerivedPtr);
+    if (_idEncoding == PointerIdEncoding::Relative)
+      // 0 is reserved for null pointer
+      details::writeVarint(writer, nextId - ptrInfo.id + 1u);
+    else
+      details::writeSize(writer, ptrInfo.id);
     return ptrInfo;
   }
 
+  // serializes object later, see DeferredObjectsQueue
+  template<typename Ser>
+  void processDeferred(Ser& ser,
+                       DeferredObjectsQueue::TProcessFnc fnc,
+                       void* obj)
+  {
+    _deferredObjects.process(ser, fnc, obj);
+  }
+
+  // start new message, ids start from 1 again.
+  // hash map buckets and deferred objects queue capacity are kept for reuse
+  void clearSerialization()
+  {
+    _currId = 0;
+    _infos.clear();
+    _ptrMap.clear();
+    _mostDerivedMap.clear();
+    _deferredObjects.clear();
+  }
+
   // valid, when all pointers have owners.
   // we cannot serialize pointers, if we haven't serialized objects themselves
   bool isPointerSerializationValid() const
   {
     return std::all_of(
-      _ptrMap.begin(),
-      _ptrMap.end(),
-      [](const std::pair<const void*, PLCInfoSerializer>& p) {
-        return p.second.ownershipType == PointerOwnershipType::SharedOwner ||
-               p.second.ownershipType == PointerOwnershipType::Owner;
+      _infos.begin(), _infos.end(), [](const PLCInfoSerializer& info) {
+        return info.ownershipType == PointerOwnershipType::SharedOwner ||
+               info.ownershipType == PointerOwnershipType::Owner;
       });
   }
 
 private:
   size_t _currId;
-  std::unordered_map<
-    const void*,
-    PLCInfoSerializer,
-    std::hash<const void*>,
-    std::equal_to<const void*>,
-    StdPolyAlloc<std::pair<const void* const, PLCInfoSerializer>>>
-    _ptrMap;
+  PointerIdEncoding _idEncoding;
+  // deque, because returned references must stay valid
+  std::deque<PLCInfoSerializer, StdPolyAlloc<PLCInfoSerializer>> _infos;
+  TPtrMap _ptrMap;
+  TPtrMap _mostDerivedMap;
+  DeferredObjectsQueue _deferredObjects;
 };
 
 class PointerLinkingContextDeserialization
 {
 public:
   explicit PointerLinkingContextDeserialization(
-    MemResourceBase* memResource = nullptr)
+    MemResourceBase* memResource = nullptr,
+    PointerIdEncoding idEncoding = PointerIdEncoding::Absolute)
     : _memResource{ memResource }
+    , _idEncoding{ idEncoding }
+    , _lastId{ 0 }
     , _idMap{ StdPolyAlloc<std::pair<const size_t, PLCInfoDeserializer>>{
         memResource } }
+    , _deferredObjects{ memResource }
   {
   }
 
@@ -262,6 +508,46 @@ public:
     return ptrInfo;
   }
 
+  // reads pointer id, returns 0 for null pointer
+  template<typename Reader>
+  size_t readId(Reader& reader)
+  {
+    size_t id{};
+    if (_idEncoding == PointerIdEncoding::Absolute) {
+      details::readSize(reader, id, 0, std::false_type{});
+      return id;
+    }
+    details::readVarint<Reader::TConfig::CheckDataErrors>(reader, id);
+    if (!id)
+      return 0;
+    const auto distance = id - 1u;
+    if (distance > _lastId) {
+      reader.error(ReaderError::InvalidPointer);
+      return 0;
+    }
+    if (!distance)
+      return ++_lastId;
+    return _lastId + 1u - distance;
+  }
+
+  // deserializes object later, see DeferredObjectsQueue
+  template<typename Des>
+  void processDeferred(Des& des,
+                       DeferredObjectsQueue::TProcessFnc fnc,
+                       void* obj)
+  {
+    _deferredObjects.process(des, fnc, obj);
+  }
+
+  // start new message, also releases shared state of all pointers.
+  // hash map buckets and deferred objects queue capacity are kept for reuse
+  void clearDeserialization()
+  {
+    _lastId = 0;
+    _idMap.clear();
+    _deferredObjects.clear();
+  }
+
   void clearSharedState()
   {
     for (auto& item : _idMap)
@@ -289,12 +575,15 @@ public:
 
 private:
   MemResourceBase* _memResource;
+  PointerIdEncoding _idEncoding;
+  size_t _lastId;
   std::unordered_map<size_t,
                      PLCInfoDeserializer,
                      std::hash<size_t>,
                      std::equal_to<size_t>,
                      StdPolyAlloc<std::pair<const size_t, PLCInfoDeserializer>>>
     _idMap;
+  DeferredObjectsQueue _deferredObjects;
 };
 }
 
@@ -304,18 +593,42 @@ class PointerLinkingContext
   , public pointer_utils::PointerLinkingContextDeserialization
 {
 public:
-  explicit PointerLinkingContext(MemResourceBase* memResource = nullptr)
-    : pointer_utils::PointerLinkingContextSerialization(memResource)
-    , pointer_utils::PointerLinkingContextDeserialization(memResource){};
+  explicit PointerLinkingContext(
+    MemResourceBase* memResource = nullptr,
+    PointerIdEncoding idEncoding = PointerIdEncoding::Absolute)
+    : pointer_utils::PointerLinkingContextSerialization(memResource, idEncoding)
+    , pointer_utils::PointerLinkingContextDeserialization(memResource,
+                                                          idEncoding){};
 
   bool isValid() const
   {
     return isPointerSerializationValid() && isPointerDeserializationValid();
   }
+
+  // start new message
+  void clear()
+  {
+    clearSerialization();
+    clearDeserialization();
+  }
 };
 
 namespace pointer_utils {
 
+template<typename RTTI, typename T, typename = void>
+struct HasGetMostDerived : std::false_type
+{
+};
+
+template<typename RTTI, typename T>
+struct HasGetMostDerived<
+  RTTI,
+  T,
+  details::void_t<decltype(RTTI::getMostDerived(std::declval<const T*>()))>>
+  : std::true_type
+{
+};
+
 template<template<typename> class TPtrManager,
          template<typename>
          class TPolymorphicContext,
@@ -335,6 +648,22 @@ public:
   template<PointerOwnershipType Value>
   using OwnershipType = std::integral_constant<PointerOwnershipType, Value>;
 
+  // shared objects are tracked by the address of most derived object, when
+  // RTTI can provide it, so that same object can be referenced via pointers to
+  // different base classes
+  template<typename T>
+  struct IsTrackedByMostDerived
+    : std::integral_constant<
+        bool,
+        IsPolymorphic<T>::value &&
+          HasGetMostDerived<RTTI, typename TPtrManager<T>::TElement>::value &&
+          (TPtrManager<T>::getOwnership() ==
+             PointerOwnershipType::SharedOwner ||
+           TPtrManager<T>::getOwnership() ==
+             PointerOwnershipType::SharedObserver)>
+  {
+  };
+
   explicit PointerObjectExtensionBase(
     PointerType ptrType = PointerType::Nullable,
     MemResourceBase* resource = nullptr,
@@ -354,14 +683,17 @@ public:
       auto& ctx = ser.template context<
         pointer_utils::PointerLinkingContextSerialization>();
       auto& ptrInfo =
-        ctx.getInfoByPtr(getBasePtr(ptr), TPtrManager<T>::getOwnership());
-      details::writeSize(ser.adapter(), ptrInfo.id);
+        ctx.writeInfoByPtr(ser.adapter(),
+                           ptr,
+                           TPtrManager<T>::getOwnership(),
+                           getMostDerivedPtr(ptr, IsTrackedByMostDerived<T>{}));
       if (TPtrManager<T>::getOwnership() != PointerOwnershipType::Observer) {
         if (!ptrInfo.isSharedProcessed)
           serializeImpl(ser, ptr, std::forward<Fnc>(fnc), IsPolymorphic<T>{});
       }
     } else {
       assert(_ptrType == PointerType::Nullable);
+      // null pointer is single zero byte for any id encoding
       details::writeSize(ser.adapter(), 0);
     }
   }
@@ -369,10 +701,9 @@ public:
   template<typename Des, typename T, typename Fnc>
   void deserialize(Des& des, T& obj, Fnc&& fnc) const
   {
-    size_t id{};
-    details::readSize(des.adapter(), id, 0, std::false_type{});
     auto& ctx = des.template context<
       pointer_utils::PointerLinkingContextDeserialization>();
+    const auto id = ctx.readId(des.adapter());
     auto prevResource = ctx.getMemResource();
     auto memResource = _resource ? _resource : prevResource;
     // if we have resource and propagate is true, then change current resource
@@ -427,16 +758,76 @@ private:
       RTTI::template get<typename TPtrManager<TObj>::TElement>());
   }
 
+  template<typename TElement>
+  const void* getMostDerivedPtr(const TElement* ptr, std::true_type) const
+  {
+    return RTTI::getMostDerived(ptr);
+  }
+
+  template<typename TElement>
+  const void* getMostDerivedPtr(const TElement*, std::false_type) const
+  {
+    return nullptr;
+  }
+
+  // called when shared object is created, before its content is deserialized
   template<typename T>
-  const void* getBasePtr(const T* ptr) const
+  void processSharedOwner(PLCInfoDeserializer& ptrInfo, T& obj) const
+  {
+    auto ptr = TPtrManager<T>::getPtr(obj);
+    ptrInfo.processOwner(ptr);
+    ptrInfo.mostDerivedPtr = nullptr;
+    if (ptr)
+      setMostDerived(ptrInfo, ptr, IsTrackedByMostDerived<T>{});
+  }
+
+  template<typename TElement>
+  void setMostDerived(PLCInfoDeserializer& ptrInfo,
+                      TElement* ptr,
+                      std::true_type) const
+  {
+    ptrInfo.mostDerivedPtr = const_cast<void*>(RTTI::getMostDerived(ptr));
+    ptrInfo.mostDerivedTypeId = RTTI::get(*ptr);
+  }
+
+  template<typename TElement>
+  void setMostDerived(PLCInfoDeserializer&, TElement*, std::false_type) const
   {
-    // todo implement handling of types with virtual inheritance
-    // this is required to correctly track same object, when one object is
-    // derived and other is base class e.g. shared_ptr<Base> and
-    // weak_ptr<Derived> or pointer observer Base*
+  }
+
+  // returns pointer to existing shared object
+  template<typename T, typename Des>
+  typename TPtrManager<T>::TElement* getSharedPtr(Des& des,
+                                                  PLCInfoDeserializer& ptrInfo,
+                                                  std::true_type) const
+  {
+    using TElement = typename TPtrManager<T>::TElement;
+    if (!ptrInfo.mostDerivedPtr) {
+      // object was created via pointer, that is not tracked by most derived
+      // address, so it has the same address
+      auto ptr = static_cast<TElement*>(ptrInfo.ownerPtr);
+      if (ptr)
+        setMostDerived(ptrInfo, ptr, std::true_type{});
+      return ptr;
+    }
+    if (ptrInfo.mostDerivedTypeId == RTTI::template get<TElement>())
+      return static_cast<TElement*>(ptrInfo.mostDerivedPtr);
+    const auto& ctx = des.template context<TPolymorphicContext<RTTI>>();
+    auto ptr = ctx.template castFromMostDerived<TElement>(
+      ptrInfo.mostDerivedPtr, ptrInfo.mostDerivedTypeId);
+    if (!ptr)
+      des.adapter().error(ReaderError::InvalidPointer);
     return ptr;
   }
 
+  template<typename T, typename Des>
+  typename TPtrManager<T>::TElement* getSharedPtr(Des&,
+                                                  PLCInfoDeserializer& ptrInfo,
+                                                  std::false_type) const
+  {
+    return static_cast<typename TPtrManager<T>::TElement*>(ptrInfo.ownerPtr);
+  }
+
   template<typename Ser, typename TPtr, typename Fnc>
   void serializeImpl(Ser& ser, TPtr& ptr, Fnc&&, std::true_type) const
   {
@@ -516,18 +907,24 @@ private:
           const std::shared_ptr<PolymorphicHandlerBase>& handler) {
           TPtrManager<T>::createSharedPolymorphic(
             createAndGetSharedStateObj<T>(ptrInfo), obj, memResource, handler);
+          processSharedOwner(ptrInfo, obj);
           return TPtrManager<T>::getPtr(obj);
         },
         [&obj,
          memResource](const std::shared_ptr<PolymorphicHandlerBase>& handler) {
           TPtrManager<T>::destroyPolymorphic(obj, memResource, handler);
         });
-      if (!ptrInfo.sharedState)
+      if (!ptrInfo.sharedState) {
         TPtrManager<T>::saveToSharedState(
           createAndGetSharedStateObj<T>(ptrInfo), obj);
+        processSharedOwner(ptrInfo, obj);
+      }
+    } else {
+      TPtrManager<T>::loadFromSharedState(
+        getSharedStateObj<T>(ptrInfo),
+        obj,
+        getSharedPtr<T>(des, ptrInfo, IsTrackedByMostDerived<T>{}));
     }
-    TPtrManager<T>::loadFromSharedState(getSharedStateObj<T>(ptrInfo), obj);
-    ptrInfo.processOwner(TPtrManager<T>::getPtr(obj));
   }
 
   template<typename Des, typename T, typename Fnc>
@@ -552,10 +949,14 @@ private:
           RTTI::template get<typename TPtrManager<T>::TElement>());
         ptr = TPtrManager<T>::getPtr(obj);
       }
+      processSharedOwner(ptrInfo, obj);
       fnc(des, *ptr);
+    } else {
+      TPtrManager<T>::loadFromSharedState(
+        getSharedStateObj<T>(ptrInfo),
+        obj,
+        getSharedPtr<T>(des, ptrInfo, IsTrackedByMostDerived<T>{}));
     }
-    TPtrManager<T>::loadFromSharedState(getSharedStateObj<T>(ptrInfo), obj);
-    ptrInfo.processOwner(TPtrManager<T>::getPtr(obj));
   }
 
   template<typename Des, typename T, typename Fnc, typename isPolymorph>
@@ -595,13 +996,7 @@ private:
     PLCInfoDeserializer& info) const
   {
     using TSharedState = typename TPtrManager<T>::TSharedState;
-    StdPolyAlloc<TSharedState> alloc{ info.memResource };
-    auto* ptr = alloc.allocate(1);
-    auto* obj = new (ptr) TSharedState{};
-    info.sharedState =
-      std::unique_ptr<PointerSharedStateBase, PointerSharedStateDeleter>(
-        obj, PointerSharedStateDeleter{ info.memResource });
-    return *obj;
+    return info.sharedState.template emplace<TSharedState>(info.memResource);
   }
 
   template<typename T>
@@ -609,7 +1004,7 @@ private:
     PLCInfoDeserializer& info) const
   {
     return static_cast<typename TPtrManager<T>::TSharedState&>(
-      *info.sharedState);
+      *info.sharedState.get());
   }
 
   PointerType _ptrType;
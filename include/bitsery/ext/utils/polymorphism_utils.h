@@ -24,6 +24,8 @@
 #define BITSERY_EXT_POLYMORPHISM_UTILS_H
 
 #include "memory_resource.h"
+#include "rtti_utils.h"
+#include <cstdlib>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -73,6 +75,14 @@ public:
   virtual void destroy(const pointer_utils::PolyAllocWithTypeId& alloc,
                        void* ptr) const = 0;
 
+  // creates object together with shared_ptr control block in single
+  // allocation, returned pointer points to base
+  virtual std::shared_ptr<void> createShared(
+    const pointer_utils::PolyAllocWithTypeId& alloc) const = 0;
+
+  // converts pointer to most derived object, to pointer to base
+  virtual void* fromDerived(void* obj) const = 0;
+
   virtual void process(void* ser, void* obj) const = 0;
 
   virtual ~PolymorphicHandlerBase() = default;
@@ -93,6 +103,18 @@ public:
     alloc.deleteObject<TDerived>(fromBase(ptr), RTTI::template get<TDerived>());
   }
 
+  std::shared_ptr<void> createShared(
+    const pointer_utils::PolyAllocWithTypeId& alloc) const final
+  {
+    auto obj = std::allocate_shared<TDerived>(
+      pointer_utils::StdPolyAllocWithTypeId<TDerived>{
+        alloc, RTTI::template get<TDerived>() });
+    auto base = toBase(obj.get());
+    return std::shared_ptr<void>(obj, base);
+  }
+
+  void* fromDerived(void* obj) const final { return toBase(obj); }
+
   void process(void* ser, void* obj) const final
   {
     static_cast<TSerializer*>(ser)->object(*fromBase(obj));
@@ -110,8 +132,11 @@ private:
   }
 };
 
+// stores polymorphic handlers for registered base/derived pairs.
+// after registration it is only read, so same registry can be shared between
+// multiple contexts (see PolymorphicContext constructor).
 template<typename RTTI>
-class PolymorphicContext
+class PolymorphicHandlerRegistry
 {
 private:
   struct BaseToDerivedKey
@@ -135,6 +160,50 @@ private:
     }
   };
 
+  // store shared ptr to polymorphic handler, because it might be copied to
+  // "smart pointer" deleter, and index that is written for this derived type
+  struct HandlerInfo
+  {
+    std::shared_ptr<PolymorphicHandlerBase> handler;
+    size_t derivedIndex;
+    const void* derivedTag;
+  };
+
+  // returns unique address for each type, so that different derived types
+  // with the same type id are detected when registering
+  template<typename T>
+  static const void* typeTag()
+  {
+    static const char tag{};
+    return &tag;
+  }
+
+  // derived types of the base in registration order, so that handler can be
+  // found directly by index that was read
+  struct DerivedHandler
+  {
+    size_t derivedHash;
+    std::shared_ptr<PolymorphicHandlerBase> handler;
+  };
+
+  using TBaseToDerivedMap =
+    std::unordered_map<BaseToDerivedKey,
+                       HandlerInfo,
+                       BaseToDerivedKeyHashier,
+                       std::equal_to<BaseToDerivedKey>,
+                       pointer_utils::StdPolyAlloc<
+                         std::pair<const BaseToDerivedKey, HandlerInfo>>>;
+
+  using TDerivedHandlers =
+    std::vector<DerivedHandler, pointer_utils::StdPolyAlloc<DerivedHandler>>;
+
+  using TBaseToDerivedArray = std::unordered_map<
+    size_t,
+    TDerivedHandlers,
+    std::hash<size_t>,
+    std::equal_to<size_t>,
+    pointer_utils::StdPolyAlloc<std::pair<const size_t, TDerivedHandlers>>>;
+
   template<typename TSerializer,
            template<typename>
            class THierarchy,
@@ -142,11 +211,20 @@ private:
            typename TDerived>
   void add()
   {
+    static_assert(hasUniqueTypeIds<TDerived>(
+                    typename THierarchy<TDerived>::Childs{}),
+                  "Derived classes and their base must have unique type ids.");
     addToMap<TSerializer, TBase, TDerived>(std::is_abstract<TDerived>{});
     addChilds<TSerializer, THierarchy, TBase, TDerived>(
       typename THierarchy<TDerived>::Childs{});
   }
 
+  template<typename TBase, typename... Ts>
+  static constexpr bool hasUniqueTypeIds(PolymorphicClassesList<Ts...>)
+  {
+    return HasUniqueTypeIds<RTTI, TBase, Ts...>::value;
+  }
+
   template<typename TSerializer,
            template<typename>
            class THierarchy,
@@ -190,17 +268,27 @@ private:
         alloc.deallocate(data, 1);
       },
       alloc);
-    if (_baseToDerivedMap.emplace(key, std::move(handler)).second) {
-      auto it = _baseToDerivedArray.find(key.baseHash);
-      if (it == _baseToDerivedArray.end()) {
-        it = _baseToDerivedArray
-               .emplace(std::piecewise_construct,
-                        std::forward_as_tuple(key.baseHash),
-                        std::forward_as_tuple(
-                          pointer_utils::StdPolyAlloc<size_t>{ _memResource }))
-               .first;
-      }
-      it->second.push_back(key.derivedHash);
+    auto it = _baseToDerivedArray.find(key.baseHash);
+    if (it == _baseToDerivedArray.end()) {
+      it = _baseToDerivedArray
+             .emplace(std::piecewise_construct,
+                      std::forward_as_tuple(key.baseHash),
+                      std::forward_as_tuple(
+                        pointer_utils::StdPolyAlloc<DerivedHandler>{
+                          _memResource }))
+             .first;
+    }
+    auto& derived = it->second;
+    auto res = _baseToDerivedMap.emplace(
+      key, HandlerInfo{ handler, derived.size(), typeTag<TDerived>() });
+    if (res.second) {
+      derived.push_back(DerivedHandler{ key.derivedHash, std::move(handler) });
+    } else if (res.first->second.derivedTag != typeTag<TDerived>()) {
+      // same class can be registered multiple times, but different classes
+      // cannot have the same type id (e.g. duplicate PolymorphicTypeId),
+      // otherwise one of them would be processed by wrong handler
+      assert(false && "different classes have the same type id");
+      std::abort();
     }
   }
 
@@ -211,47 +299,55 @@ private:
   }
 
   MemResourceBase* _memResource;
-  // store shared ptr to polymorphic handler, because it might be copied to
-  // "smart pointer" deleter
-  std::unordered_map<BaseToDerivedKey,
-                     std::shared_ptr<PolymorphicHandlerBase>,
-                     BaseToDerivedKeyHashier,
-                     std::equal_to<BaseToDerivedKey>,
-                     pointer_utils::StdPolyAlloc<
-                       std::pair<const BaseToDerivedKey,
-                                 std::shared_ptr<PolymorphicHandlerBase>>>>
-    _baseToDerivedMap;
+  TBaseToDerivedMap _baseToDerivedMap;
   // this will allow convert from platform specific type information, to
   // platform independent base->derived index this only works if all polymorphic
   // relationships (PolymorphicBaseClass<TBase> ->
   // PolymorphicDerivedClasses<TDerived...>) is equal between platforms.
-  std::unordered_map<
-    size_t,
-    std::vector<size_t, pointer_utils::StdPolyAlloc<size_t>>,
-    std::hash<size_t>,
-    std::equal_to<size_t>,
-    pointer_utils::StdPolyAlloc<
-      std::pair<const size_t,
-                std::vector<size_t, pointer_utils::StdPolyAlloc<size_t>>>>>
-    _baseToDerivedArray;
+  TBaseToDerivedArray _baseToDerivedArray;
+
+  template<typename TSerializer,
+           template<typename>
+           class THierarchy,
+           typename... Ts>
+  static PolymorphicHandlerRegistry create(PolymorphicClassesList<Ts...> list)
+  {
+    PolymorphicHandlerRegistry registry{};
+    registry.registerBasesList<TSerializer, THierarchy>(list);
+    return registry;
+  }
 
 public:
-  explicit PolymorphicContext(MemResourceBase* memResource = nullptr)
+  explicit PolymorphicHandlerRegistry(MemResourceBase* memResource = nullptr)
     : _memResource{ memResource }
-    , _baseToDerivedMap{ pointer_utils::StdPolyAlloc<
-        std::pair<const BaseToDerivedKey,
-                  std::shared_ptr<PolymorphicHandlerBase>>>{ memResource } }
-    , _baseToDerivedArray{ pointer_utils::StdPolyAlloc<
-        std::pair<const size_t,
-                  std::vector<size_t, pointer_utils::StdPolyAlloc<size_t>>>>{
+    , _baseToDerivedMap{ typename TBaseToDerivedMap::allocator_type{
+        memResource } }
+    , _baseToDerivedArray{ typename TBaseToDerivedArray::allocator_type{
         memResource } }
   {
   }
 
-  PolymorphicContext(const PolymorphicContext&) = delete;
-  PolymorphicContext& operator=(const PolymorphicContext&) = delete;
-  PolymorphicContext(PolymorphicContext&&) = default;
-  PolymorphicContext& operator=(PolymorphicContext&&) = default;
+  PolymorphicHandlerRegistry(const PolymorphicHandlerRegistry&) = delete;
+  PolymorphicHandlerRegistry& operator=(const PolymorphicHandlerRegistry&) =
+    delete;
+  PolymorphicHandlerRegistry(PolymorphicHandlerRegistry&&) = default;
+  PolymorphicHandlerRegistry& operator=(PolymorphicHandlerRegistry&&) = default;
+
+  // returns process-wide registry for TSerializer with all classes
+  // registered, it is built once (thread-safe static initialization) and
+  // never modified afterwards, so it can be used by many contexts on many
+  // threads concurrently, without any locking.
+  // handlers are allocated using default memory resource.
+  template<typename TSerializer,
+           template<typename> class THierarchy = PolymorphicBaseClass,
+           typename... Ts>
+  static const PolymorphicHandlerRegistry& getStatic(
+    PolymorphicClassesList<Ts...> list)
+  {
+    static const PolymorphicHandlerRegistry registry =
+      create<TSerializer, THierarchy>(list);
+    return registry;
+  }
 
   void clear()
   {
@@ -300,15 +396,12 @@ public:
     auto it = _baseToDerivedMap.find(key);
     assert(it != _baseToDerivedMap.end());
 
-    // convert derived hash to derived index, to make it work in cross-platform
-    // environment
-    auto& vec = _baseToDerivedArray.find(key.baseHash)->second;
-    auto derivedIndex = static_cast<size_t>(std::distance(
-      vec.begin(), std::find(vec.begin(), vec.end(), key.derivedHash)));
-    details::writeSize(ser.adapter(), derivedIndex);
+    // write derived index instead of derived hash, to make it work in
+    // cross-platform environment
+    details::writeSize(ser.adapter(), it->second.derivedIndex);
 
     // serialize
-    it->second->process(&ser, &obj);
+    it->second.handler->process(&ser, &obj);
   }
 
   template<typename Deserializer,
@@ -331,23 +424,35 @@ public:
     if (baseToDerivedVecIt->second.size() > derivedIndex) {
       // convert derived index to derived hash, to make it work in
       // cross-platform environment
-      auto derivedHash = baseToDerivedVecIt->second[derivedIndex];
-      auto& handler =
-        _baseToDerivedMap
-          .find(BaseToDerivedKey{ RTTI::template get<TBase>(), derivedHash })
-          ->second;
+      const auto& derived = baseToDerivedVecIt->second[derivedIndex];
+      const auto derivedHash = derived.derivedHash;
+      const auto& handler = derived.handler;
       // if object is null or different type, create new and assign it
       if (obj == nullptr || RTTI::template get<TBase>(*obj) != derivedHash) {
         if (obj) {
           destroyFnc(getPolymorphicHandler(*obj));
         }
         obj = createFnc(handler);
+        // type id of created object must match registered one
+        assert(RTTI::template get<TBase>(*obj) == derivedHash);
       }
       handler->process(&des, obj);
     } else
       des.adapter().error(ReaderError::InvalidPointer);
   }
 
+  // converts pointer to most derived object of type derivedHash to TBase*,
+  // returns nullptr if this relationship is not registered
+  template<typename TBase>
+  TBase* castFromMostDerived(void* obj, size_t derivedHash) const
+  {
+    auto it = _baseToDerivedMap.find(
+      BaseToDerivedKey{ RTTI::template get<TBase>(), derivedHash });
+    return it != _baseToDerivedMap.end()
+             ? static_cast<TBase*>(it->second.handler->fromDerived(obj))
+             : nullptr;
+  }
+
   template<typename TBase>
   const std::shared_ptr<PolymorphicHandlerBase>& getPolymorphicHandler(
     TBase& obj) const
@@ -355,10 +460,105 @@ public:
     auto deleteHandlerIt = _baseToDerivedMap.find(BaseToDerivedKey{
       RTTI::template get<TBase>(), RTTI::template get<TBase>(obj) });
     assert(deleteHandlerIt != _baseToDerivedMap.end());
-    return deleteHandlerIt->second;
+    return deleteHandlerIt->second.handler;
   }
 };
 
+template<typename RTTI>
+class PolymorphicContext
+{
+public:
+  using Registry = PolymorphicHandlerRegistry<RTTI>;
+
+  explicit PolymorphicContext(MemResourceBase* memResource = nullptr)
+    : _registry{ memResource }
+  {
+  }
+
+  // use already built registry (e.g. Registry::getStatic) instead of
+  // registering classes for every context, registry must outlive context and
+  // no classes can be registered in this context.
+  explicit PolymorphicContext(const Registry& registry)
+    : _registry{}
+    , _sharedRegistry{ &registry }
+  {
+  }
+
+  PolymorphicContext(const PolymorphicContext&) = delete;
+  PolymorphicContext& operator=(const PolymorphicContext&) = delete;
+  PolymorphicContext(PolymorphicContext&&) = default;
+  PolymorphicContext& operator=(PolymorphicContext&&) = default;
+
+  void clear()
+  {
+    _registry.clear();
+    _sharedRegistry = nullptr;
+  }
+
+  // THierarchy is the name of class, that defines hierarchy
+  // PolymorphicBaseClass is defined as default parameter, so that at
+  // instantiation time it will get unique symbol in translation unit for
+  // PolymorphicBaseClass (which is defined in anonymous namespace)
+  // https://github.com/fraillt/bitsery/issues/9
+  template<typename TSerializer,
+           template<typename> class THierarchy = PolymorphicBaseClass,
+           typename... Ts>
+  void registerBasesList(PolymorphicClassesList<Ts...> list)
+  {
+    assert(_sharedRegistry == nullptr);
+    _registry.template registerBasesList<TSerializer, THierarchy>(list);
+  }
+
+  // optional method, in case you want to construct base class hierarchy your
+  // self
+  template<typename TSerializer, typename TBase, typename TDerived>
+  void registerSingleBaseBranch()
+  {
+    assert(_sharedRegistry == nullptr);
+    _registry.template registerSingleBaseBranch<TSerializer, TBase, TDerived>();
+  }
+
+  template<typename Serializer, typename TBase>
+  void serialize(Serializer& ser, TBase& obj) const
+  {
+    registry().serialize(ser, obj);
+  }
+
+  template<typename Deserializer,
+           typename TBase,
+           typename TCreateFnc,
+           typename TDestroyFnc>
+  void deserialize(Deserializer& des,
+                   TBase* obj,
+                   TCreateFnc createFnc,
+                   TDestroyFnc destroyFnc) const
+  {
+    registry().deserialize(des, obj, createFnc, destroyFnc);
+  }
+
+  template<typename TBase>
+  TBase* castFromMostDerived(void* obj, size_t derivedHash) const
+  {
+    return registry().template castFromMostDerived<TBase>(obj, derivedHash);
+  }
+
+  template<typename TBase>
+  const std::shared_ptr<PolymorphicHandlerBase>& getPolymorphicHandler(
+    TBase& obj) const
+  {
+    return registry().getPolymorphicHandler(obj);
+  }
+
+private:
+  const Registry& registry() const
+  {
+    return _sharedRegistry ? *_sharedRegistry : _registry;
+  }
+
+  Registry _registry;
+  const Registry* _sharedRegistry{};
+};
+
 }
 
 }
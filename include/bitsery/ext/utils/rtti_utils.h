@@ -30,6 +30,9 @@
 namespace bitsery {
 namespace ext {
 
+// StandardRTTI requires compiler RTTI, when it is disabled (e.g. -fno-rtti)
+// it is only declared, and TypeIdRTTI can be used instead.
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
 struct StandardRTTI
 {
 
@@ -57,6 +60,217 @@ struct StandardRTTI
   {
     return std::is_polymorphic<TBase>::value;
   }
+
+  // address of most derived object, it is used to identify same object when
+  // it is referenced via pointers to different base classes
+  template<typename TBase>
+  static const void* getMostDerived(const TBase* obj)
+  {
+    return getMostDerived(obj, std::is_polymorphic<TBase>{});
+  }
+
+private:
+  template<typename TBase>
+  static const void* getMostDerived(const TBase* obj, std::true_type)
+  {
+    return dynamic_cast<const void*>(obj);
+  }
+
+  template<typename TBase>
+  static const void* getMostDerived(const TBase* obj, std::false_type)
+  {
+    return obj;
+  }
+};
+#else
+struct StandardRTTI;
+#endif
+
+// specialize for each polymorphic type (including bases) when using
+// TypeIdRTTI, ids must be unique and not 0 (0 is used for non-polymorphic
+// types), e.g.
+//  template<> struct PolymorphicTypeId<Animal>
+//    : std::integral_constant<size_t, 1> {};
+template<typename T>
+struct PolymorphicTypeId
+{
+};
+
+namespace rtti_details {
+
+template<typename T, typename = void>
+struct HasPolymorphicTypeId : std::false_type
+{
+};
+
+template<typename T>
+struct HasPolymorphicTypeId<T,
+                            decltype(void(PolymorphicTypeId<T>::value))>
+  : std::true_type
+{
+};
+
+// type id or 0 if PolymorphicTypeId<T> is not specialized
+template<typename T, bool = HasPolymorphicTypeId<T>::value>
+struct TypeIdOrZero : std::integral_constant<size_t, 0>
+{
+};
+
+template<typename T>
+struct TypeIdOrZero<T, true>
+  : std::integral_constant<size_t, PolymorphicTypeId<T>::value>
+{
+};
+
+template<typename T, typename... Ts>
+struct TypeIdDiffersFromAll : std::true_type
+{
+};
+
+template<typename T, typename U, typename... Ts>
+struct TypeIdDiffersFromAll<T, U, Ts...>
+  : std::integral_constant<bool,
+                           (TypeIdOrZero<T>::value == 0 ||
+                            TypeIdOrZero<T>::value !=
+                              TypeIdOrZero<U>::value) &&
+                             TypeIdDiffersFromAll<T, Ts...>::value>
+{
+};
+
+template<typename... Ts>
+struct UniqueTypeIds : std::true_type
+{
+};
+
+template<typename T, typename... Ts>
+struct UniqueTypeIds<T, Ts...>
+  : std::integral_constant<bool,
+                           TypeIdDiffersFromAll<T, Ts...>::value &&
+                             UniqueTypeIds<Ts...>::value>
+{
+};
+
+template<typename T>
+struct MemberFunctionClass;
+
+template<typename R, typename C>
+struct MemberFunctionClass<R (C::*)() const>
+{
+  using type = C;
+};
+
+#if defined(__cpp_noexcept_function_type)
+template<typename R, typename C>
+struct MemberFunctionClass<R (C::*)() const noexcept>
+{
+  using type = C;
+};
+#endif
+
+// checks that T declares polymorphicTypeId itself, instead of inheriting it
+// from base class, abstract classes don't need it
+template<typename T,
+         bool = std::is_polymorphic<T>::value && !std::is_abstract<T>::value>
+struct OverridesPolymorphicTypeId : std::true_type
+{
+};
+
+template<typename T>
+struct OverridesPolymorphicTypeId<T, true>
+  : std::is_same<
+      T,
+      typename MemberFunctionClass<decltype(&T::polymorphicTypeId)>::type>
+{
+};
+
+}
+
+// RTTI that doesn't use typeid or dynamic_cast, so it works with -fno-rtti.
+// static type id is taken from PolymorphicTypeId<T>, and dynamic type id is
+// returned by virtual member function, that each polymorphic type must
+// override, e.g.
+//  size_t polymorphicTypeId() const override {
+//    return bitsery::ext::PolymorphicTypeId<Dog>::value;
+//  }
+// type ids must be unique within hierarchy: it is checked at compile time for
+// each PolymorphicDerivedClasses list (see HasUniqueTypeIds), and at runtime
+// when classes are registered, registration aborts if different classes have
+// the same type id.
+// non-polymorphic types can also specialize PolymorphicTypeId<T>, otherwise
+// their type id is 0 (e.g. MemResourceSlab forwards such allocations upstream).
+// derived type is obtained via static_cast, so polymorphic types cannot have
+// virtual base classes.
+struct TypeIdRTTI
+{
+  template<typename TBase>
+  static size_t get(TBase& obj)
+  {
+    return getTypeId(obj, std::is_polymorphic<TBase>{});
+  }
+
+  template<typename TBase>
+  static constexpr size_t get()
+  {
+    return getTypeId<TBase>(rtti_details::HasPolymorphicTypeId<TBase>{});
+  }
+
+  template<typename TBase, typename TDerived>
+  static constexpr TDerived* cast(TBase* obj)
+  {
+    static_assert(!std::is_pointer<TDerived>::value, "");
+    return static_cast<TDerived*>(obj);
+  }
+
+  template<typename TBase>
+  static constexpr bool isPolymorphic()
+  {
+    return std::is_polymorphic<TBase>::value;
+  }
+
+private:
+  template<typename TBase>
+  static size_t getTypeId(TBase& obj, std::true_type)
+  {
+    return obj.polymorphicTypeId();
+  }
+
+  template<typename TBase>
+  static size_t getTypeId(TBase&, std::false_type)
+  {
+    return 0;
+  }
+
+  template<typename TBase>
+  static constexpr size_t getTypeId(std::true_type)
+  {
+    static_assert(rtti_details::OverridesPolymorphicTypeId<TBase>::value,
+                  "Polymorphic type must override polymorphicTypeId(), "
+                  "otherwise it is serialized as its base class.");
+    return PolymorphicTypeId<TBase>::value;
+  }
+
+  template<typename TBase>
+  static constexpr size_t getTypeId(std::false_type)
+  {
+    static_assert(!std::is_polymorphic<TBase>::value,
+                  "Polymorphic type must specialize PolymorphicTypeId<T>, "
+                  "when used with TypeIdRTTI.");
+    return 0;
+  }
+};
+
+// checks at compile time that types Ts have different type ids.
+// PolymorphicHandlerRegistry checks each list of derived classes (together with
+// their base class), RTTI that gets type ids at runtime (e.g. StandardRTTI) is
+// only checked when classes are registered.
+template<typename RTTI, typename... Ts>
+struct HasUniqueTypeIds : std::true_type
+{
+};
+
+template<typename... Ts>
+struct HasUniqueTypeIds<TypeIdRTTI, Ts...> : rtti_details::UniqueTypeIds<Ts...>
+{
 };
 
 }
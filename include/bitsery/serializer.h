@@ -37,6 +37,8 @@ public:
   // serialize function when enabling bitpacking
   using BPEnabledType =
     Serializer<typename TOutputAdapter::BitPackingEnabled, TContext>;
+  // helper type, that is passed to `fixedSizeRegion` function
+  using FixedRegionType = Serializer;
   using TConfig = typename TOutputAdapter::TConfig;
 
   using details::AdapterAndContextRef<TOutputAdapter,
@@ -97,6 +99,17 @@ public:
       std::integral_constant<bool, Serializer::HasContext>{});
   }
 
+  /*
+   * fixed size region, deserializer checks bounds once for whole region.
+   * `size` must be exact number of bytes that `fnc` writes.
+   */
+  template<typename Fnc>
+  void fixedSizeRegion(size_t size, Fnc&& fnc)
+  {
+    static_cast<void>(size); // only meaningful for deserializer
+    fnc(*this);
+  }
+
   /*
    * extension functions
    */
@@ -319,31 +332,31 @@ public:
   template<typename T, typename Ext>
   void ext1b(const T& v, Ext&& extension)
   {
-    ext<1, T, Ext>(v, std::forward<Ext>(extension));
+    ext<1>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext2b(const T& v, Ext&& extension)
   {
-    ext<2, T, Ext>(v, std::forward<Ext>(extension));
+    ext<2>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext4b(const T& v, Ext&& extension)
   {
-    ext<4, T, Ext>(v, std::forward<Ext>(extension));
+    ext<4>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext8b(const T& v, Ext&& extension)
   {
-    ext<8, T, Ext>(v, std::forward<Ext>(extension));
+    ext<8>(v, std::forward<Ext>(extension));
   }
 
   template<typename T, typename Ext>
   void ext16b(const T& v, Ext&& extension)
   {
-    ext<16, T, Ext>(v, std::forward<Ext>(extension));
+    ext<16>(v, std::forward<Ext>(extension));
   }
 
   template<typename T>
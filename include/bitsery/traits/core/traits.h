@@ -24,7 +24,9 @@
 #define BITSERY_TRAITS_CORE_TRAITS_H
 
 #include "../../details/not_defined_type.h"
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace bitsery {
 namespace traits {
@@ -135,6 +137,82 @@ struct ContainerTraits<T*>
   }
 };
 
+// traits for associative containers (maps and sets), used by StdMap and StdSet.
+// default implementation works with std containers and hash maps that has
+// compatible interface, specialize it for other containers.
+template<typename T>
+struct AssociativeContainerTraits
+{
+  static void clear(T& obj) { obj.clear(); }
+
+  // called before inserting `size` elements, does nothing if container
+  // doesn't have `reserve` member function
+  static void reserve(T& obj, size_t size) { reserveImpl(obj, size, 0); }
+
+  // insert element constructed from `args`, returns iterator to inserted
+  // element that is used as hint for next element
+  template<typename It, typename... Args>
+  static It emplace(T& obj, It hint, Args&&... args)
+  {
+    return obj.emplace_hint(hint, std::forward<Args>(args)...);
+  }
+
+private:
+  template<typename Q>
+  static auto reserveImpl(Q& obj, size_t size, int)
+    -> decltype(obj.reserve(size), void())
+  {
+    obj.reserve(size);
+  }
+
+  static void reserveImpl(T&, size_t, long) {}
+};
+
+// defines how to fill sorted flat map, used by FlatMap, elements are always
+// appended at the end in sorted order. default implementation works with types
+// that has flat_map interface (e.g. boost::container::flat_map).
+template<typename T>
+struct FlatMapTraits
+{
+  using TKey = typename T::key_type;
+  using TValue = typename T::mapped_type;
+  using TCompare = typename T::key_compare;
+
+  // comparator that is used to verify order
+  static TCompare keyComp(const T& obj) { return obj.key_comp(); }
+
+  static void clear(T& obj) { obj.clear(); }
+
+  static void reserve(T& obj, size_t size) { obj.reserve(size); }
+
+  static void append(T& obj, TKey&& key, TValue&& value)
+  {
+    obj.emplace_hint(obj.end(), std::move(key), std::move(value));
+  }
+};
+
+// defines how to fill sorted flat set, used by FlatSet, elements are always
+// appended at the end in sorted order. default implementation works with types
+// that has flat_set interface (e.g. boost::container::flat_set).
+template<typename T>
+struct FlatSetTraits
+{
+  using TKey = typename T::key_type;
+  using TCompare = typename T::key_compare;
+
+  // comparator that is used to verify order
+  static TCompare keyComp(const T& obj) { return obj.key_comp(); }
+
+  static void clear(T& obj) { obj.clear(); }
+
+  static void reserve(T& obj, size_t size) { obj.reserve(size); }
+
+  static void append(T& obj, TKey&& key)
+  {
+    obj.emplace_hint(obj.end(), std::move(key));
+  }
+};
+
 // traits for text, default adds null-terminated character at the end
 template<typename T>
 struct TextTraits
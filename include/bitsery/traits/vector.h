@@ -24,6 +24,8 @@
 #define BITSERY_TRAITS_STD_VECTOR_H
 
 #include "core/std_defaults.h"
+#include <functional>
+#include <utility>
 #include <vector>
 
 namespace bitsery {
@@ -48,6 +50,63 @@ struct BufferAdapterTraits<std::vector<T, Allocator>>
 {
 };
 
+// sorted vector of pairs, used by FlatMap
+template<typename Key, typename T, typename Allocator>
+struct FlatMapTraits<std::vector<std::pair<Key, T>, Allocator>>
+{
+  using TKey = Key;
+  using TValue = T;
+  using TCompare = std::less<Key>;
+
+  static TCompare keyComp(const std::vector<std::pair<Key, T>, Allocator>&)
+  {
+    return TCompare{};
+  }
+
+  static void clear(std::vector<std::pair<Key, T>, Allocator>& obj)
+  {
+    obj.clear();
+  }
+
+  static void reserve(std::vector<std::pair<Key, T>, Allocator>& obj,
+                      size_t size)
+  {
+    obj.reserve(size);
+  }
+
+  static void append(std::vector<std::pair<Key, T>, Allocator>& obj,
+                     Key&& key,
+                     T&& value)
+  {
+    obj.emplace_back(std::move(key), std::move(value));
+  }
+};
+
+// sorted vector, used by FlatSet
+template<typename Key, typename Allocator>
+struct FlatSetTraits<std::vector<Key, Allocator>>
+{
+  using TKey = Key;
+  using TCompare = std::less<Key>;
+
+  static TCompare keyComp(const std::vector<Key, Allocator>&)
+  {
+    return TCompare{};
+  }
+
+  static void clear(std::vector<Key, Allocator>& obj) { obj.clear(); }
+
+  static void reserve(std::vector<Key, Allocator>& obj, size_t size)
+  {
+    obj.reserve(size);
+  }
+
+  static void append(std::vector<Key, Allocator>& obj, Key&& key)
+  {
+    obj.emplace_back(std::move(key));
+  }
+};
+
 }
 
 }
@@ -439,6 +439,42 @@ TYPED_TEST(InputAll, WhenReaderHasErrorsAllThenReadsReturnZero)
   EXPECT_THAT(r1, Eq(0));
 }
 
+TYPED_TEST(InputAll, SkipBytesAdvancesReadPosition)
+{
+  Buffer buf{};
+  OutputAdapter w{ buf };
+  for (uint8_t i = 0; i < 200; ++i)
+    w.writeBytes<1>(i);
+  w.flush();
+  buf.resize(w.writtenBytesCount());
+
+  auto r = this->config.createReader(buf);
+
+  uint8_t r1{};
+  r.skipBytes(3);
+  r.template readBytes<1>(r1);
+  EXPECT_THAT(r1, Eq(3));
+  // more than internal chunk size of stream adapter
+  r.skipBytes(150);
+  r.template readBytes<1>(r1);
+  EXPECT_THAT(r1, Eq(154));
+  r.skipBytes(45);
+  EXPECT_THAT(r.isCompletedSuccessfully(), Eq(true));
+}
+
+TYPED_TEST(InputAll, WhenSkippingMoreThanAvailableThenDataOverflow)
+{
+  Buffer buf{};
+  OutputAdapter w{ buf };
+  w.writeBytes<2>(uint16_t{ 1 });
+  w.flush();
+  buf.resize(w.writtenBytesCount());
+
+  auto r = this->config.createReader(buf);
+  r.skipBytes(3);
+  EXPECT_THAT(r.error(), Eq(ReaderError::DataOverflow));
+}
+
 template<template<typename...> class TAdapter>
 struct OutBufferConfig
 {
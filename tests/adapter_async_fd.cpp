@@ -0,0 +1,270 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gmock/gmock.h>
+
+#if __cplusplus >= 202002L && defined(__unix__)
+
+#include "serialization_test_utils.h"
+#include <bitsery/adapter/async_fd.h>
+#include <bitsery/traits/vector.h>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+using namespace testing;
+
+using bitsery::AsyncTask;
+
+namespace {
+
+// single threaded reactor, that resumes coroutines when fd becomes ready
+struct PollReactor
+{
+  struct Waiter
+  {
+    int fd;
+    short events;
+    std::coroutine_handle<> handle;
+  };
+
+  std::vector<Waiter> waiters{};
+  size_t suspendCount{};
+
+  void waitReadable(int fd, std::coroutine_handle<> h)
+  {
+    waiters.push_back({ fd, POLLIN, h });
+    ++suspendCount;
+  }
+
+  void waitWritable(int fd, std::coroutine_handle<> h)
+  {
+    waiters.push_back({ fd, POLLOUT, h });
+    ++suspendCount;
+  }
+
+  void run()
+  {
+    while (!waiters.empty()) {
+      std::vector<pollfd> fds{};
+      for (auto& w : waiters)
+        fds.push_back({ w.fd, w.events, 0 });
+      if (::poll(fds.data(), fds.size(), 1000) <= 0)
+        return;
+      std::vector<Waiter> ready{};
+      std::vector<Waiter> pending{};
+      for (size_t i = 0; i < fds.size(); ++i) {
+        if (fds[i].revents)
+          ready.push_back(waiters[i]);
+        else
+          pending.push_back(waiters[i]);
+      }
+      waiters = std::move(pending);
+      for (auto& w : ready)
+        w.handle.resume();
+    }
+  }
+};
+
+struct SocketPair
+{
+  int fds[2]{ -1, -1 };
+
+  SocketPair()
+  {
+    ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+    for (auto fd : fds)
+      ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+  }
+
+  SocketPair(const SocketPair&) = delete;
+  SocketPair& operator=(const SocketPair&) = delete;
+
+  ~SocketPair()
+  {
+    for (auto fd : fds)
+      if (fd >= 0)
+        ::close(fd);
+  }
+
+  void close(int idx)
+  {
+    ::close(fds[idx]);
+    fds[idx] = -1;
+  }
+};
+
+template<typename T>
+AsyncTask<bool>
+sendObjects(PollReactor& reactor, int fd, const std::vector<T>& objects)
+{
+  for (auto& obj : objects) {
+    Buffer buf{};
+    auto size = bitsery::quickSerialization<Writer>(buf, obj);
+    if (!co_await bitsery::asyncWriteFrame(reactor, fd, buf, size))
+      co_return false;
+  }
+  co_return true;
+}
+
+template<typename T>
+AsyncTask<bool>
+receiveObjects(PollReactor& reactor, int fd, std::vector<T>& objects)
+{
+  Buffer buf{};
+  for (auto& obj : objects) {
+    size_t size{};
+    if (!co_await bitsery::asyncReadFrame(reactor, fd, buf, 10000000u, size))
+      co_return false;
+    auto state =
+      bitsery::quickDeserialization<Reader>({ buf.begin(), size }, obj);
+    if (state.first != bitsery::ReaderError::NoError || !state.second)
+      co_return false;
+  }
+  co_return true;
+}
+
+struct BigObject
+{
+  std::vector<uint32_t> data{};
+
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.container4b(data, 10000000u);
+  }
+};
+
+}
+
+TEST(AdapterAsyncFd, WhenSocketBufferIsFullThenWriterSuspendsUntilReaderReads)
+{
+  SocketPair sockets{};
+  PollReactor reactor{};
+  std::vector<BigObject> data(1);
+  // bigger than socket buffer
+  for (uint32_t i = 0; i < 1000000u; ++i)
+    data[0].data.push_back(i);
+  std::vector<BigObject> res(1);
+
+  auto writer = sendObjects(reactor, sockets.fds[0], data);
+  auto reader = receiveObjects(reactor, sockets.fds[1], res);
+  writer.start();
+  reader.start();
+  reactor.run();
+
+  EXPECT_TRUE(writer.done() && writer.result());
+  EXPECT_TRUE(reader.done() && reader.result());
+  EXPECT_THAT(res[0].data, ContainerEq(data[0].data));
+  EXPECT_THAT(reactor.suspendCount, Gt(0u));
+}
+
+TEST(AdapterAsyncFd, MultipleFramesInSameStream)
+{
+  SocketPair sockets{};
+  PollReactor reactor{};
+  std::vector<MyStruct1> data{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+  std::vector<MyStruct1> res(3);
+
+  // reader starts first, and waits for data
+  auto reader = receiveObjects(reactor, sockets.fds[1], res);
+  auto writer = sendObjects(reactor, sockets.fds[0], data);
+  reader.start();
+  EXPECT_FALSE(reader.done());
+  writer.start();
+  reactor.run();
+
+  EXPECT_TRUE(writer.done() && writer.result());
+  EXPECT_TRUE(reader.done() && reader.result());
+  EXPECT_THAT(res, ContainerEq(data));
+}
+
+TEST(AdapterAsyncFd, WhenPeerClosesThenReadFails)
+{
+  SocketPair sockets{};
+  PollReactor reactor{};
+  std::vector<MyStruct1> res(1);
+
+  auto reader = receiveObjects(reactor, sockets.fds[1], res);
+  reader.start();
+  sockets.close(0);
+  reactor.run();
+
+  EXPECT_TRUE(reader.done());
+  EXPECT_FALSE(reader.result());
+}
+
+TEST(AdapterAsyncFd, WhenFrameIsBiggerThanMaxSizeThenReadFails)
+{
+  SocketPair sockets{};
+  PollReactor reactor{};
+  Buffer buf(100);
+  Buffer res{};
+  size_t size{};
+
+  auto writer = bitsery::asyncWriteFrame(reactor, sockets.fds[0], buf, 100u);
+  auto reader =
+    bitsery::asyncReadFrame(reactor, sockets.fds[1], res, 99u, size);
+  writer.start();
+  reader.start();
+  reactor.run();
+
+  EXPECT_TRUE(writer.done() && writer.result());
+  EXPECT_TRUE(reader.done());
+  EXPECT_FALSE(reader.result());
+}
+
+TEST(AdapterAsyncFd, WhenFrameSizeDoesntFitInHeaderThenWriteFails)
+{
+  if (sizeof(size_t) <= sizeof(uint32_t))
+    GTEST_SKIP();
+  SocketPair sockets{};
+  PollReactor reactor{};
+  Buffer buf(100);
+
+  // size is checked before buffer is accessed
+  auto writer = bitsery::asyncWriteFrame(
+    reactor, sockets.fds[0], buf, static_cast<size_t>(UINT32_MAX) + 1u);
+  writer.start();
+  reactor.run();
+
+  EXPECT_TRUE(writer.done());
+  EXPECT_FALSE(writer.result());
+}
+
+TEST(AdapterAsyncFd, WhenPeerClosesThenWriteFailsWithoutSignal)
+{
+  SocketPair sockets{};
+  PollReactor reactor{};
+  std::vector<MyStruct1> data{ { 1, 2 } };
+
+  sockets.close(1);
+  auto writer = sendObjects(reactor, sockets.fds[0], data);
+  writer.start();
+  reactor.run();
+
+  EXPECT_TRUE(writer.done());
+  EXPECT_FALSE(writer.result());
+}
+
+#endif
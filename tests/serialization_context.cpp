@@ -116,3 +116,24 @@ TEST(SerializationContext,
     EXPECT_THAT(des.context<Base>().value, Eq(std::get<1>(ctx2).value));
   }
 }
+
+TEST(SerializationContext, HasContextIsResolvedAtCompileTime)
+{
+  using Ser1 = BasicSerializationContext<MultipleTypesContext>::TSerializer;
+  static_assert(Ser1::hasContext<int>(), "");
+  static_assert(Ser1::hasContext<char>(), "");
+  static_assert(!Ser1::hasContext<double>(), "");
+
+  using Ser2 = BasicSerializationContext<Derived>::TSerializer;
+  static_assert(Ser2::hasContext<Base>(), "");
+  static_assert(!Ser2::hasContext<int>(), "");
+
+  using Des3 = BasicSerializationContext<void>::TDeserializer;
+  static_assert(!Des3::hasContext<int>(), "");
+
+  Derived ctx{};
+  BasicSerializationContext<Derived> c;
+  auto& ser = c.createSerializer(ctx);
+  EXPECT_TRUE(ser.hasContext<Base>());
+  EXPECT_THAT(&ser.context<Base>(), Eq(static_cast<Base*>(&ctx)));
+}
@@ -0,0 +1,141 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+#if __cplusplus > 201402L
+
+#include <bitsery/ext/columnar.h>
+#include <bitsery/traits/string.h>
+
+using namespace testing;
+
+using bitsery::ext::column;
+using bitsery::ext::ColumnEncoding;
+using bitsery::ext::Columnar;
+
+struct Trade
+{
+  int64_t time{};
+  double price{};
+  uint32_t quantity{};
+  MyEnumClass side{};
+  MyStruct1 extra{};
+
+  bool operator==(const Trade& rhs) const
+  {
+    return time == rhs.time && price == rhs.price &&
+           quantity == rhs.quantity && side == rhs.side && extra == rhs.extra;
+  }
+};
+
+std::vector<Trade>
+createTrades()
+{
+  return { Trade{ 1000000, 1.5, 10u, MyEnumClass::E1, MyStruct1{ 1, 2 } },
+           Trade{ 1000005, 1.25, 300u, MyEnumClass::E2, MyStruct1{ 3, 4 } },
+           Trade{ 1000003, -7.0, 5u, MyEnumClass::E1, MyStruct1{ 5, 6 } } };
+}
+
+TEST(SerializeExtensionColumnar, RawColumnsAreWrittenAsContiguousRuns)
+{
+  auto src = createTrades();
+  SerializationContext ctx;
+  ctx.createSerializer().ext(
+    src, Columnar{ 10, column(&Trade::quantity), column(&Trade::time) });
+
+  auto& des = ctx.createDeserializer();
+  uint8_t size{};
+  uint32_t quantities[3]{};
+  int64_t times[3]{};
+  des.value1b(size);
+  des.container4b(quantities);
+  des.container8b(times);
+  EXPECT_THAT(size, Eq(3u));
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1u + 3u * 4u + 3u * 8u));
+  EXPECT_THAT(quantities, ElementsAre(10u, 300u, 5u));
+  EXPECT_THAT(times, ElementsAre(1000000, 1000005, 1000003));
+}
+
+TEST(SerializeExtensionColumnar, AllColumnTypesAndEncodings)
+{
+  auto src = createTrades();
+  std::vector<Trade> res{ Trade{} };
+  const auto columns =
+    Columnar{ 10,
+              column<ColumnEncoding::Delta>(&Trade::time),
+              column(&Trade::price),
+              column<ColumnEncoding::Varint>(&Trade::quantity),
+              column<ColumnEncoding::Varint>(&Trade::side),
+              column(&Trade::extra) };
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, columns);
+  ctx.createDeserializer().ext(res, columns);
+
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionColumnar, DeltaEncodingWritesDifferenceFromPrevious)
+{
+  auto src = createTrades();
+  SerializationContext ctx;
+  ctx.createSerializer().ext(
+    src, Columnar{ 10, column<ColumnEncoding::Delta>(&Trade::time) });
+  // 1000000 takes 3 bytes, +5 and -2 takes 1 byte each
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1u + 3u + 1u + 1u));
+}
+
+TEST(SerializeExtensionColumnar, DeltaEncodingWrapsAround)
+{
+  std::vector<Trade> src{ Trade{}, Trade{}, Trade{} };
+  src[0].time = std::numeric_limits<int64_t>::max();
+  src[1].time = std::numeric_limits<int64_t>::min();
+  src[2].time = 0;
+  std::vector<Trade> res{};
+  const auto columns =
+    Columnar{ 10, column<ColumnEncoding::Delta>(&Trade::time) };
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, columns);
+  ctx.createDeserializer().ext(res, columns);
+
+  ASSERT_THAT(res.size(), Eq(3u));
+  EXPECT_THAT(res[0].time, Eq(src[0].time));
+  EXPECT_THAT(res[1].time, Eq(src[1].time));
+  EXPECT_THAT(res[2].time, Eq(src[2].time));
+}
+
+TEST(SerializeExtensionColumnar, WhenSizeIsMoreThanMaxThenInvalidData)
+{
+  auto src = createTrades();
+  std::vector<Trade> res{};
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, Columnar{ 10, column(&Trade::time) });
+  ctx.createDeserializer().ext(res, Columnar{ 2, column(&Trade::time) });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+  EXPECT_THAT(res.size(), Eq(0u));
+}
+
+#endif
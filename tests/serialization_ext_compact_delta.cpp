@@ -0,0 +1,145 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/compact_delta.h>
+#include <bitsery/traits/array.h>
+#include <bitsery/traits/vector.h>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using bitsery::ext::CompactDelta;
+using bitsery::ext::CompactDeltaBitPacked;
+
+using testing::ContainerEq;
+using testing::Eq;
+
+using BPSer = SerializationContext::TSerializerBPEnabled;
+using BPDes = SerializationContext::TDeserializerBPEnabled;
+
+TEST(SerializeExtensionCompactDelta, MonotonicValuesAreWrittenAsSmallDeltas)
+{
+  std::vector<int64_t> src{ 1000000, 1000001, 1000003, 1000010, 1000100 };
+  std::vector<int64_t> res{ 5 };
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, CompactDelta{ 10 });
+  ctx.createDeserializer().ext(res, CompactDelta{ 10 });
+
+  // size, first value in 3 bytes, 3 deltas in 1 byte, and 1 in 2 bytes
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1u + 3u + 3u + 2u));
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionCompactDelta, DecreasingValuesAndWrapAround)
+{
+  std::vector<int32_t> src{ 5,
+                            -3,
+                            std::numeric_limits<int32_t>::max(),
+                            std::numeric_limits<int32_t>::min(),
+                            0 };
+  std::vector<uint16_t> srcUnsigned{ 65535, 0, 10, 9 };
+  std::vector<int32_t> res{};
+  std::vector<uint16_t> resUnsigned{};
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.ext(src, CompactDelta{ 10 });
+  ser.ext(srcUnsigned, CompactDelta{ 10 });
+  auto& des = ctx.createDeserializer();
+  des.ext(res, CompactDelta{ 10 });
+  des.ext(resUnsigned, CompactDelta{ 10 });
+
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(resUnsigned, ContainerEq(srcUnsigned));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionCompactDelta, FixedSizeContainerAndEnums)
+{
+  std::array<MyEnumClass, 3> src{ MyEnumClass::E2,
+                                  MyEnumClass::E6,
+                                  MyEnumClass::E1 };
+  std::array<MyEnumClass, 3> res{};
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, CompactDelta{ 10 });
+  ctx.createDeserializer().ext(res, CompactDelta{ 10 });
+
+  EXPECT_THAT(ctx.getBufferSize(), Eq(3u));
+  EXPECT_THAT(res, ContainerEq(src));
+}
+
+TEST(SerializeExtensionCompactDelta, WhenSizeIsMoreThanMaxThenInvalidData)
+{
+  std::vector<int32_t> src{ 1, 2, 3 };
+  std::vector<int32_t> res{};
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, CompactDelta{ 10 });
+  ctx.createDeserializer().ext(res, CompactDelta{ 2 });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionCompactDeltaBitPacked, DeltasArePackedInBlocks)
+{
+  // 300 values with deltas 1000..1003, so that offsets fit in 2 bits
+  std::vector<uint64_t> src{};
+  uint64_t value = 1u << 20;
+  for (auto i = 0u; i < 300u; ++i) {
+    src.push_back(value);
+    value += 1000u + i % 4u;
+  }
+  std::vector<uint64_t> res{};
+  SerializationContext ctx;
+  ctx.createSerializer().enableBitPacking(
+    [&src](BPSer& ser) { ser.ext(src, CompactDeltaBitPacked{ 1000 }); });
+  ctx.createDeserializer().enableBitPacking(
+    [&res](BPDes& des) { des.ext(res, CompactDeltaBitPacked{ 1000 }); });
+
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+  // size, first value, and 3 blocks with 2 bytes base, 7 bits width and 2 bit
+  // offsets for each value
+  const auto blocksBits = 3u * (16u + 7u) + 299u * 2u;
+  EXPECT_THAT(ctx.getBufferSize(), Eq(2u + 4u + (blocksBits + 7u) / 8u));
+}
+
+TEST(SerializeExtensionCompactDeltaBitPacked, SignedAndEqualValues)
+{
+  std::vector<int16_t> src{ -5, -5, -5, 100, -32768, 32767, 0 };
+  std::vector<int16_t> equal(130, int16_t{ 7 });
+  std::vector<int16_t> res{};
+  std::vector<int16_t> resEqual{};
+  SerializationContext ctx;
+  ctx.createSerializer().enableBitPacking([&](BPSer& ser) {
+    ser.ext(src, CompactDeltaBitPacked{ 1000 });
+    ser.ext(equal, CompactDeltaBitPacked{ 1000 });
+  });
+  ctx.createDeserializer().enableBitPacking([&](BPDes& des) {
+    des.ext(res, CompactDeltaBitPacked{ 1000 });
+    des.ext(resEqual, CompactDeltaBitPacked{ 1000 });
+  });
+
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(resEqual, ContainerEq(equal));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
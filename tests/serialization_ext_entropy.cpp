@@ -225,3 +225,75 @@ TEST(SerializeExtensionEntropy, WhenEntropyEncodedThenCustomFunctionNotInvoked)
   EXPECT_THAT(res, Eq(v));
   EXPECT_THAT(ctx.getBufferSize(), Eq(1));
 }
+
+TEST(SerializeExtensionHashedEntropy, SameEncodingAsEntropy)
+{
+  std::vector<int32_t> values{};
+  for (auto i = 0; i < 300; ++i)
+    values.push_back(i * 13);
+  const bitsery::ext::HashedEntropy<std::vector<int32_t>> hashed{ values };
+  std::vector<int32_t> src{ 0, 13 * 299, 13 * 150, 7, 13 * 150 };
+
+  SerializationContext ctx1{};
+  SerializationContext ctx2{};
+  ctx1.createSerializer().enableBitPacking([&src, &values](BPSer& ser) {
+    for (auto& v : src)
+      ser.ext4b(v, Entropy<std::vector<int32_t>>{ values });
+  });
+  ctx2.createSerializer().enableBitPacking([&src, &hashed](BPSer& ser) {
+    for (auto& v : src)
+      ser.ext4b(v, hashed);
+  });
+  std::vector<int32_t> res(src.size());
+  ctx2.createDeserializer().enableBitPacking([&res, &hashed](BPDes& des) {
+    for (auto& v : res)
+      des.ext4b(v, hashed);
+  });
+
+  EXPECT_THAT(ctx2.buf, ContainerEq(ctx1.buf));
+  EXPECT_THAT(res, ContainerEq(src));
+}
+
+TEST(SerializeExtensionHashedEntropy, WhenValueIsNarrowedThenNotEntropyEncoded)
+{
+  // 65541 converted to int16_t would be 5
+  int32_t v = 65541;
+  int32_t res{};
+  int16_t values[3] = { 1, 5, 9 };
+  const bitsery::ext::HashedEntropy<int16_t[3]> hashed{ values };
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking(
+    [&v, &hashed](BPSer& ser) { ser.ext4b(v, hashed); });
+  ctx.createDeserializer().enableBitPacking(
+    [&res, &hashed](BPDes& des) { des.ext4b(res, hashed); });
+
+  EXPECT_THAT(res, Eq(v));
+  EXPECT_THAT(ctx.getBufferSize(), Eq(sizeof(int32_t) + 1));
+}
+
+struct MyStruct1Hash
+{
+  size_t operator()(const MyStruct1& v) const
+  {
+    return std::hash<int32_t>{}(v.i1) ^ std::hash<int32_t>{}(v.i2);
+  }
+};
+
+TEST(SerializeExtensionHashedEntropy, CustomTypeWithCustomHash)
+{
+  MyStruct1 v = { 4849, 89 };
+  MyStruct1 res{};
+  std::vector<MyStruct1> values{ MyStruct1{ 12, 10 },
+                                 MyStruct1{ 485, 454 },
+                                 MyStruct1{ 4849, 89 } };
+  const bitsery::ext::HashedEntropy<std::vector<MyStruct1>, MyStruct1Hash>
+    hashed{ values };
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking(
+    [&v, &hashed](BPSer& ser) { ser.ext(v, hashed); });
+  ctx.createDeserializer().enableBitPacking(
+    [&res, &hashed](BPDes& des) { des.ext(res, hashed); });
+
+  EXPECT_THAT(res, Eq(v));
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1));
+}
@@ -0,0 +1,202 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/flat_map.h>
+#include <bitsery/ext/std_map.h>
+#include <bitsery/traits/string.h>
+#include <algorithm>
+#include <map>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using FlatMap = bitsery::ext::FlatMap;
+using StdMap = bitsery::ext::StdMap;
+
+using testing::ContainerEq;
+using testing::Eq;
+
+// stateful comparator, that can sort in both directions
+struct KeyOrder
+{
+  explicit KeyOrder(bool desc = false)
+    : descending{ desc }
+  {
+  }
+
+  bool operator()(int32_t a, int32_t b) const
+  {
+    return descending ? b < a : a < b;
+  }
+
+  bool descending;
+};
+
+// minimal flat_map like container, that is used via default FlatMapTraits
+struct SortedTable
+{
+  using key_type = int32_t;
+  using mapped_type = std::string;
+  using key_compare = KeyOrder;
+  using value_type = std::pair<int32_t, std::string>;
+  using iterator = std::vector<value_type>::iterator;
+  using const_iterator = std::vector<value_type>::const_iterator;
+
+  void clear() { data.clear(); }
+  void reserve(size_t size) { data.reserve(size); }
+  iterator emplace_hint(const_iterator, int32_t&& key, std::string&& value)
+  {
+    ++emplaceHintCount;
+    auto it = std::lower_bound(
+      data.begin(), data.end(), key, [this](const value_type& v, int32_t k) {
+        return comp(v.first, k);
+      });
+    return data.emplace(it, std::move(key), std::move(value));
+  }
+  key_compare key_comp() const { return comp; }
+  iterator begin() { return data.begin(); }
+  iterator end() { return data.end(); }
+  const_iterator begin() const { return data.begin(); }
+  const_iterator end() const { return data.end(); }
+
+  std::vector<value_type> data{};
+  size_t emplaceHintCount{};
+  key_compare comp{};
+};
+
+template<typename S, typename T>
+void
+serializeMap(S& s, T& o, FlatMap ext)
+{
+  s.ext(o, ext, [](S& s, int32_t& key, std::string& value) {
+    s.value4b(key);
+    s.text1b(value, 100);
+  });
+}
+
+template<typename S, typename T>
+void
+serializeStdMap(S& s, T& o)
+{
+  s.ext(o, StdMap{ 10 }, [](S& s, int32_t& key, std::string& value) {
+    s.value4b(key);
+    s.text1b(value, 100);
+  });
+}
+
+TEST(SerializeExtensionFlatMap, SameFormatAsStdMap)
+{
+  std::map<int32_t, std::string> src{ { 5, "five" },
+                                       { -7, "minus seven" },
+                                       { 98, "ninety eight" } };
+  std::vector<std::pair<int32_t, std::string>> res{ { 1, "one" } };
+
+  SerializationContext ctx;
+  serializeStdMap(ctx.createSerializer(), src);
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10 });
+
+  EXPECT_THAT(res,
+              ContainerEq(std::vector<std::pair<int32_t, std::string>>(
+                src.begin(), src.end())));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+
+  std::map<int32_t, std::string> back{};
+  SerializationContext ctx2;
+  serializeMap(ctx2.createSerializer(), res, FlatMap{ 10 });
+  serializeStdMap(ctx2.createDeserializer(), back);
+  EXPECT_THAT(back, ContainerEq(src));
+}
+
+TEST(SerializeExtensionFlatMap, FlatMapLikeTypeAppendsAtTheEnd)
+{
+  std::map<int32_t, std::string> src{ { 1, "a" }, { 2, "b" }, { 3, "c" } };
+  SortedTable res{};
+
+  SerializationContext ctx;
+  serializeStdMap(ctx.createSerializer(), src);
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10, true });
+
+  EXPECT_THAT(res.emplaceHintCount, Eq(3u));
+  EXPECT_THAT(res.data,
+              ContainerEq(std::vector<std::pair<int32_t, std::string>>(
+                src.begin(), src.end())));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionFlatMap, WhenVerifyOrderThenContainerComparatorIsUsed)
+{
+  std::map<int32_t, std::string, std::greater<int32_t>> src{ { 1, "a" },
+                                                             { 2, "b" },
+                                                             { 3, "c" } };
+  SortedTable res{};
+  res.comp = KeyOrder{ true };
+
+  SerializationContext ctx;
+  serializeStdMap(ctx.createSerializer(), src);
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10, true });
+
+  EXPECT_THAT(res.data,
+              ContainerEq(std::vector<std::pair<int32_t, std::string>>(
+                src.begin(), src.end())));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionFlatMap, WhenTrustedThenUnsortedInputIsNotChecked)
+{
+  std::vector<std::pair<int32_t, std::string>> src{ { 5, "a" }, { 1, "b" } };
+  std::vector<std::pair<int32_t, std::string>> res{};
+
+  SerializationContext ctx;
+  serializeMap(ctx.createSerializer(), src, FlatMap{ 10 });
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10 });
+
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionFlatMap, WhenVerifyOrderAndUnsortedThenInvalidData)
+{
+  std::vector<std::pair<int32_t, std::string>> src{ { 1, "a" },
+                                                    { 5, "b" },
+                                                    { 3, "c" } };
+  std::vector<std::pair<int32_t, std::string>> res{};
+
+  SerializationContext ctx;
+  serializeMap(ctx.createSerializer(), src, FlatMap{ 10 });
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10, true });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionFlatMap, WhenVerifyOrderAndDuplicateKeysThenInvalidData)
+{
+  std::vector<std::pair<int32_t, std::string>> src{ { 1, "a" }, { 1, "b" } };
+  std::vector<std::pair<int32_t, std::string>> res{};
+
+  SerializationContext ctx;
+  serializeMap(ctx.createSerializer(), src, FlatMap{ 10 });
+  serializeMap(ctx.createDeserializer(), res, FlatMap{ 10, true });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
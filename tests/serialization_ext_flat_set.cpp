@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/flat_set.h>
+#include <bitsery/ext/std_set.h>
+#include <set>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using FlatSet = bitsery::ext::FlatSet;
+using StdSet = bitsery::ext::StdSet;
+
+using testing::ContainerEq;
+using testing::Eq;
+
+TEST(SerializeExtensionFlatSet, SameFormatAsStdSet)
+{
+  std::set<int32_t> src{ 4, 8, 48, -4, 9845 };
+  std::vector<int32_t> res{ 78, 74 };
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext4b(src, StdSet{ 10 });
+  ctx.createDeserializer().ext4b(res, FlatSet{ 10 });
+
+  EXPECT_THAT(res, ContainerEq(std::vector<int32_t>(src.begin(), src.end())));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+
+  std::set<int32_t> back{};
+  SerializationContext ctx2;
+  ctx2.createSerializer().ext4b(res, FlatSet{ 10 });
+  ctx2.createDeserializer().ext4b(back, StdSet{ 10 });
+  EXPECT_THAT(back, ContainerEq(src));
+}
+
+TEST(SerializeExtensionFlatSet, ObjectSyntax)
+{
+  std::set<MyStruct1> src{ MyStruct1{ 874, 456 },
+                           MyStruct1{ -874, -456 },
+                           MyStruct1{ 4894, 0 } };
+  std::vector<MyStruct1> res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, StdSet{ 10 });
+  ctx.createDeserializer().ext(res, FlatSet{ 10, true });
+
+  EXPECT_THAT(res,
+              ContainerEq(std::vector<MyStruct1>(src.begin(), src.end())));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionFlatSet, WhenVerifyOrderAndUnsortedThenInvalidData)
+{
+  std::vector<int32_t> src{ 1, 5, 3 };
+  std::vector<int32_t> res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext4b(src, FlatSet{ 10 });
+  ctx.createDeserializer().ext4b(res, FlatSet{ 10, true });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionFlatSet, WhenVerifyOrderAndDuplicatesThenInvalidData)
+{
+  std::vector<int32_t> src{ 1, 3, 3 };
+  std::vector<int32_t> res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext4b(src, FlatSet{ 10 });
+  ctx.createDeserializer().ext4b(res, FlatSet{ 10, true });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
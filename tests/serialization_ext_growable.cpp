@@ -251,3 +251,22 @@ TEST(SerializeExtensionGrowable, MultipleNestedSessionsReadOlderVersionData)
   }
   EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
 }
+
+TEST(SerializeExtensionGrowable, SkipJumpsOverWholeSession)
+{
+  SerializationContext ctx;
+  DataV2 data{ 8454, 987451 };
+  auto& ser = ctx.createSerializer();
+  ser.ext(data, Growable{}, [](decltype(ser)& ser, DataV2& o) {
+    ser.value4b(o.v1);
+    ser.value4b(o.v2);
+  });
+  ser.value2b(int16_t{ 7 });
+
+  auto& des = ctx.createDeserializer();
+  int16_t res{};
+  des.skipExt(Growable{});
+  des.value2b(res);
+  EXPECT_THAT(res, Eq(7));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
@@ -0,0 +1,173 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/huffman_entropy.h>
+#include <bitsery/traits/vector.h>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+using bitsery::ext::Entropy;
+using bitsery::ext::HuffmanEntropy;
+
+using BPSer = SerializationContext::TSerializerBPEnabled;
+using BPDes = SerializationContext::TDeserializerBPEnabled;
+
+TEST(SerializeExtensionHuffmanEntropy, WhenMostFrequentValueThenWriteOneBit)
+{
+  int32_t values[3] = { 485, 4849, 89 };
+  uint32_t frequencies[3] = { 1, 1000, 10 };
+  const HuffmanEntropy<int32_t[3]> huffman{ values, frequencies };
+  std::vector<int32_t> src(8, 4849);
+  std::vector<int32_t> res{};
+
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking([&src, &huffman](BPSer& ser) {
+    ser.container(src, 10, [&huffman](BPSer& s, int32_t& v) {
+      s.ext4b(v, huffman);
+    });
+  });
+  ctx.createDeserializer().enableBitPacking([&res, &huffman](BPDes& des) {
+    des.container(res, 10, [&huffman](BPDes& d, int32_t& v) {
+      d.ext4b(v, huffman);
+    });
+  });
+
+  EXPECT_THAT(res, ContainerEq(src));
+  // container size + 8 single bit codes
+  EXPECT_THAT(ctx.getBufferSize(), Eq(2));
+}
+
+TEST(SerializeExtensionHuffmanEntropy,
+     WhenDistributionIsSkewedThenSmallerThanEntropy)
+{
+  std::vector<int32_t> values{};
+  std::vector<uint32_t> frequencies{};
+  for (auto i = 0; i < 64; ++i) {
+    values.push_back(i * 7);
+    frequencies.push_back(i < 4 ? 1000u : 1u);
+  }
+  const HuffmanEntropy<std::vector<int32_t>> huffman{ values, frequencies };
+  const Entropy<std::vector<int32_t>> entropy{ values };
+  std::vector<int32_t> src{};
+  for (auto i = 0; i < 100; ++i)
+    src.push_back((i % 4) * 7);
+
+  SerializationContext ctx1{};
+  ctx1.createSerializer().enableBitPacking([&src, &huffman](BPSer& ser) {
+    ser.container(src, 100, [&huffman](BPSer& s, int32_t& v) {
+      s.ext4b(v, huffman);
+    });
+  });
+  SerializationContext ctx2{};
+  ctx2.createSerializer().enableBitPacking([&src, &entropy](BPSer& ser) {
+    ser.container(src, 100, [&entropy](BPSer& s, int32_t& v) {
+      s.ext4b(v, entropy);
+    });
+  });
+
+  EXPECT_THAT(ctx1.getBufferSize(), Lt(ctx2.getBufferSize() / 2));
+}
+
+TEST(SerializeExtensionHuffmanEntropy, WhenValueNotInListThenWriteEscapeCode)
+{
+  std::vector<int32_t> values{};
+  std::vector<uint32_t> frequencies{};
+  for (auto i = 0; i < 200; ++i) {
+    values.push_back(i * 13);
+    // very skewed distribution, to get long codes
+    frequencies.push_back(1u << (i % 31));
+  }
+  const HuffmanEntropy<std::vector<int32_t>> huffman{ values, frequencies };
+  std::vector<int32_t> src{};
+  for (auto i = 0; i < 500; ++i)
+    src.push_back((i * 31 % 211) * 13 + (i % 17 == 0 ? 1 : 0));
+  std::vector<int32_t> res{};
+
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking([&src, &huffman](BPSer& ser) {
+    ser.container(src, 1000, [&huffman](BPSer& s, int32_t& v) {
+      s.ext4b(v, huffman);
+    });
+  });
+  ctx.createDeserializer().enableBitPacking([&res, &huffman](BPDes& des) {
+    des.container(res, 1000, [&huffman](BPDes& d, int32_t& v) {
+      d.ext4b(v, huffman);
+    });
+  });
+
+  EXPECT_THAT(res, ContainerEq(src));
+}
+
+TEST(SerializeExtensionHuffmanEntropy, WhenAlignBeforeDataThenAlignAfterCode)
+{
+  int32_t values[3] = { 485, 4849, 89 };
+  uint32_t frequencies[3] = { 1, 1000, 10 };
+  const HuffmanEntropy<int32_t[3]> huffman{ values, frequencies, true };
+  int32_t v = 7;
+  int32_t res{};
+
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking(
+    [&v, &huffman](BPSer& ser) { ser.ext4b(v, huffman); });
+  ctx.createDeserializer().enableBitPacking(
+    [&res, &huffman](BPDes& des) { des.ext4b(res, huffman); });
+
+  EXPECT_THAT(res, Eq(v));
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1 + sizeof(int32_t)));
+}
+
+TEST(SerializeExtensionHuffmanEntropy, WhenSingleValueThenRoundtrip)
+{
+  int32_t values[1] = { 485 };
+  uint32_t frequencies[1] = { 3 };
+  const HuffmanEntropy<int32_t[1]> huffman{ values, frequencies };
+  int32_t v1 = 485;
+  int32_t v2 = 11;
+  int32_t res1{};
+  int32_t res2{};
+
+  SerializationContext ctx{};
+  ctx.createSerializer().enableBitPacking([&](BPSer& ser) {
+    ser.ext4b(v1, huffman);
+    ser.ext4b(v2, huffman);
+  });
+  ctx.createDeserializer().enableBitPacking([&](BPDes& des) {
+    des.ext4b(res1, huffman);
+    des.ext4b(res2, huffman);
+  });
+
+  EXPECT_THAT(res1, Eq(v1));
+  EXPECT_THAT(res2, Eq(v2));
+}
+
+TEST(SerializeExtensionHuffmanEntropy,
+     WhenFrequenciesSizeDoesntMatchValuesThenAssert)
+{
+  int32_t values[3] = { 485, 4849, 89 };
+  std::vector<uint32_t> fewer{ 5 };
+  std::vector<uint32_t> more{ 5, 3, 2, 1, 1 };
+  EXPECT_DEBUG_DEATH((HuffmanEntropy<int32_t[3]>{ values, fewer }), "");
+  EXPECT_DEBUG_DEATH((HuffmanEntropy<int32_t[3]>{ values, more }), "");
+}
@@ -0,0 +1,266 @@
+// MIT License
+//
+// Copyright (c) 2026 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+#if __cplusplus > 201402L
+
+#include <bitsery/ext/indexed_object.h>
+#include <bitsery/traits/string.h>
+
+using namespace testing;
+
+using bitsery::ext::IndexedObject;
+using bitsery::ext::IndexedObjectAccessor;
+
+struct Record
+{
+  int32_t id;
+  std::string name;
+  MyStruct1 inner;
+  int16_t extra;
+};
+
+// fields are listed in separate lambdas, so each one gets an entry in offset
+// table
+const auto RecordFieldsV2 =
+  IndexedObject{ [](auto& s, Record& o) { s.value4b(o.id); },
+                 [](auto& s, Record& o) { s.text1b(o.name, 100); },
+                 [](auto& s, Record& o) {
+                   s.ext(o.inner,
+                         IndexedObject{
+                           [](auto& s, MyStruct1& o) { s.value4b(o.i1); },
+                           [](auto& s, MyStruct1& o) { s.value4b(o.i2); } });
+                 } };
+
+const auto RecordFieldsV3 =
+  IndexedObject{ [](auto& s, Record& o) { s.value4b(o.id); },
+                 [](auto& s, Record& o) { s.text1b(o.name, 100); },
+                 [](auto& s, Record& o) {
+                   s.ext(o.inner,
+                         IndexedObject{
+                           [](auto& s, MyStruct1& o) { s.value4b(o.i1); },
+                           [](auto& s, MyStruct1& o) { s.value4b(o.i2); } });
+                 },
+                 [](auto& s, Record& o) { s.value2b(o.extra); } };
+
+TEST(SerializeExtensionIndexedObject, HeaderContainsSizeFieldsCountAndOffsets)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  MyStruct1 data{ 4, 5 };
+  ser.ext(data,
+          IndexedObject{ [](auto& s, MyStruct1& o) { s.value4b(o.i1); },
+                         [](auto& s, MyStruct1& o) { s.value4b(o.i2); } });
+
+  auto& des = ctx.createDeserializer();
+  uint32_t size{};
+  uint32_t count{};
+  uint32_t offsets[2]{};
+  des.value4b(size);
+  des.value4b(count);
+  des.value4b(offsets[0]);
+  des.value4b(offsets[1]);
+  EXPECT_THAT(size, Eq(8u + 2u * 4u + MyStruct1::SIZE));
+  EXPECT_THAT(count, Eq(2u));
+  EXPECT_THAT(offsets[0], Eq(16u));
+  EXPECT_THAT(offsets[1], Eq(20u));
+  EXPECT_THAT(ctx.getBufferSize(), Eq(size));
+}
+
+TEST(SerializeExtensionIndexedObject, ReadSameVersionData)
+{
+  SerializationContext ctx;
+  Record data{ 7, "hello world", { 8, 9 }, 10 };
+  auto& ser = ctx.createSerializer();
+  for (auto i = 0; i < 5; ++i)
+    ser.ext(data, RecordFieldsV3);
+
+  auto& des = ctx.createDeserializer();
+  for (auto i = 0; i < 5; ++i) {
+    Record res{};
+    des.ext(res, RecordFieldsV3);
+    EXPECT_THAT(res.id, Eq(data.id));
+    EXPECT_THAT(res.name, Eq(data.name));
+    EXPECT_THAT(res.inner, Eq(data.inner));
+    EXPECT_THAT(res.extra, Eq(data.extra));
+  }
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionIndexedObject, ReadNewerAndOlderVersionData)
+{
+  SerializationContext ctxNewer;
+  Record data{ 7, "hello world", { 8, 9 }, 10 };
+  ctxNewer.createSerializer().ext(data, RecordFieldsV3);
+  ctxNewer.createSerializer().value1b(uint8_t{ 3 });
+  Record res{};
+  uint8_t after{};
+  ctxNewer.createDeserializer().ext(res, RecordFieldsV2);
+  ctxNewer.createDeserializer().value1b(after);
+  EXPECT_THAT(res.name, Eq(data.name));
+  EXPECT_THAT(res.inner, Eq(data.inner));
+  EXPECT_THAT(res.extra, Eq(0));
+  EXPECT_THAT(after, Eq(3u));
+  EXPECT_THAT(ctxNewer.des->adapter().isCompletedSuccessfully(), Eq(true));
+
+  SerializationContext ctxOlder;
+  ctxOlder.createSerializer().ext(data, RecordFieldsV2);
+  Record res2{ 1, "", { 1, 1 }, 55 };
+  ctxOlder.createDeserializer().ext(res2, RecordFieldsV3);
+  EXPECT_THAT(res2.name, Eq(data.name));
+  EXPECT_THAT(res2.inner, Eq(data.inner));
+  EXPECT_THAT(res2.extra, Eq(0));
+  EXPECT_THAT(ctxOlder.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionIndexedObject, AccessorJumpsDirectlyToField)
+{
+  SerializationContext ctx;
+  Record data{ 7, "hello world", { 8, 9 }, 10 };
+  ctx.createSerializer().ext(data, RecordFieldsV3);
+  ctx.createSerializer().value1b(uint8_t{ 3 });
+
+  auto& des = ctx.createDeserializer();
+  IndexedObjectAccessor acc{ des.adapter() };
+  EXPECT_THAT(acc.fieldsCount(), Eq(4u));
+
+  int16_t extra{};
+  EXPECT_TRUE(acc.field(3));
+  des.value2b(extra);
+  EXPECT_THAT(extra, Eq(data.extra));
+
+  // reader end is limited to the field, so it is safe to read past it
+  int32_t overflow{ 5 };
+  des.value4b(overflow);
+  EXPECT_THAT(overflow, Eq(0));
+
+  // nested indexed object, jump to second field
+  EXPECT_TRUE(acc.field(2));
+  {
+    IndexedObjectAccessor inner{ des.adapter() };
+    int32_t i2{};
+    EXPECT_TRUE(inner.field(1));
+    des.value4b(i2);
+    EXPECT_THAT(i2, Eq(data.inner.i2));
+    inner.skip();
+  }
+
+  std::string name{};
+  EXPECT_TRUE(acc.field(1));
+  des.text1b(name, 100);
+  EXPECT_THAT(name, Eq(data.name));
+
+  EXPECT_FALSE(acc.field(4));
+  acc.skip();
+  uint8_t after{};
+  des.value1b(after);
+  EXPECT_THAT(after, Eq(3u));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionIndexedObject, AccessorSkipsWholeObjects)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  std::vector<Record> data{ { 1, "first", { 1, 2 }, 3 },
+                            { 2, "second", { 4, 5 }, 6 },
+                            { 3, "third", { 7, 8 }, 9 } };
+  for (auto& r : data)
+    ser.ext(r, RecordFieldsV3);
+
+  auto& des = ctx.createDeserializer();
+  std::vector<int32_t> ids{};
+  for (auto i = 0u; i < data.size(); ++i) {
+    IndexedObjectAccessor acc{ des.adapter() };
+    int32_t id{};
+    acc.field(0);
+    des.value4b(id);
+    ids.push_back(id);
+    acc.skip();
+  }
+  EXPECT_THAT(ids, ElementsAre(1, 2, 3));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionIndexedObject, InvalidOffsetTableIsError)
+{
+  Buffer buf{};
+  Writer w{ buf };
+  w.writeBytes<4>(uint32_t{ 16 });
+  w.writeBytes<4>(uint32_t{ 2 });
+  w.writeBytes<4>(uint32_t{ 20 });
+  w.writeBytes<4>(uint32_t{ 12 });
+  Reader r{ buf.begin(), w.writtenBytesCount() };
+  IndexedObjectAccessor acc{ r };
+  EXPECT_FALSE(acc.field(0));
+  EXPECT_THAT(r.error(), Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionIndexedObject, OffsetIntoHeaderIsError)
+{
+  Buffer buf{};
+  Writer w{ buf };
+  w.writeBytes<4>(uint32_t{ 20 });
+  w.writeBytes<4>(uint32_t{ 2 });
+  w.writeBytes<4>(uint32_t{ 4 });
+  w.writeBytes<4>(uint32_t{ 16 });
+  w.writeBytes<4>(uint32_t{ 7 });
+  Reader r{ buf.begin(), w.writtenBytesCount() };
+  IndexedObjectAccessor acc{ r };
+  EXPECT_FALSE(acc.field(0));
+  EXPECT_THAT(r.error(), Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionIndexedObject, FieldsCountLargerThanObjectIsError)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.value4b(uint32_t{ 12 });
+  ser.value4b(uint32_t{ 10 });
+  ser.value4b(uint32_t{ 8 });
+  for (auto i = 0; i < 10; ++i)
+    ser.value4b(int32_t{ i });
+
+  Record res{};
+  ctx.createDeserializer().ext(res, RecordFieldsV3);
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionIndexedObject, SkipJumpsOverWholeObject)
+{
+  SerializationContext ctx;
+  Record data{ 7, "hello world", { 8, 9 }, 10 };
+  ctx.createSerializer().ext(data, RecordFieldsV3);
+  ctx.createSerializer().value1b(uint8_t{ 3 });
+
+  auto& des = ctx.createDeserializer();
+  uint8_t after{};
+  des.skipExt(RecordFieldsV3);
+  des.value1b(after);
+  EXPECT_THAT(after, Eq(3u));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+#endif
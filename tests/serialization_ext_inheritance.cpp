@@ -286,6 +286,108 @@ TEST(SerializeExtensionInheritance,
          data.size())); // 1 container size + 4 because virtual base * elements
 }
 
+/*
+ * more virtual bases than inheritance context stores inline
+ */
+template<int N>
+struct ManyVirtualBase
+{
+  uint8_t v{};
+};
+
+template<typename S, int N>
+void
+serialize(S& s, ManyVirtualBase<N>& o)
+{
+  s.value1b(o.v);
+}
+
+template<int N>
+struct ManyLeft : virtual ManyVirtualBase<N>
+{};
+
+template<int N>
+struct ManyRight : virtual ManyVirtualBase<N>
+{};
+
+template<typename S, int N>
+void
+serialize(S& s, ManyLeft<N>& o)
+{
+  s.ext(o, VirtualBaseClass<ManyVirtualBase<N>>{});
+}
+
+template<typename S, int N>
+void
+serialize(S& s, ManyRight<N>& o)
+{
+  s.ext(o, VirtualBaseClass<ManyVirtualBase<N>>{});
+}
+
+template<int N>
+struct ManyVirtualBases
+  : ManyLeft<N>
+  , ManyRight<N>
+  , ManyVirtualBases<N - 1>
+{
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.ext(*this, BaseClass<ManyLeft<N>>{});
+    s.ext(*this, BaseClass<ManyRight<N>>{});
+    s.ext(*this, BaseClass<ManyVirtualBases<N - 1>>{});
+  }
+
+  void getValues(std::vector<uint8_t>& values) const
+  {
+    values.push_back(static_cast<const ManyVirtualBase<N>&>(*this).v);
+    ManyVirtualBases<N - 1>::getValues(values);
+  }
+
+  void setValues(uint8_t first)
+  {
+    static_cast<ManyVirtualBase<N>&>(*this).v = first;
+    ManyVirtualBases<N - 1>::setValues(static_cast<uint8_t>(first + 1));
+  }
+};
+
+template<>
+struct ManyVirtualBases<0>
+{
+  template<typename S>
+  void serialize(S&)
+  {
+  }
+  void getValues(std::vector<uint8_t>&) const {}
+  void setValues(uint8_t) {}
+};
+
+TEST(SerializeExtensionInheritance,
+     MoreVirtualBasesThanInlineCapacityMultipleObjects)
+{
+  std::vector<ManyVirtualBases<12>> data(3);
+  data[0].setValues(1);
+  data[1].setValues(20);
+  data[2].setValues(40);
+  std::vector<ManyVirtualBases<12>> res{};
+
+  SerContext ctx{};
+  bitsery::ext::InheritanceContext inherCtxSer{};
+  bitsery::ext::InheritanceContext inherCtxDes{};
+  ctx.createSerializer(inherCtxSer).container(data, 10);
+  ctx.createDeserializer(inherCtxDes).container(res, 10);
+  ASSERT_THAT(res.size(), Eq(data.size()));
+  for (size_t i = 0; i < data.size(); ++i) {
+    std::vector<uint8_t> expected{};
+    std::vector<uint8_t> actual{};
+    data[i].getValues(expected);
+    res[i].getValues(actual);
+    EXPECT_THAT(actual, ::testing::ContainerEq(expected));
+  }
+  // 1 container size + 12 virtual bases, each serialized once
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1 + 12 * data.size()));
+}
+
 //
 class BasePrivateSerialize
 {
@@ -0,0 +1,134 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/interned_text.h>
+#include <bitsery/traits/string.h>
+#include <bitsery/traits/vector.h>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using bitsery::ext::InternedText;
+using bitsery::ext::InternedTextContext;
+
+using testing::ContainerEq;
+using testing::Eq;
+
+using SerContext = BasicSerializationContext<InternedTextContext<>>;
+
+template<typename S>
+void
+serializeSymbols(S& s, std::vector<std::string>& symbols)
+{
+  s.container(symbols, 100, [](S& s, std::string& str) {
+    s.ext(str, InternedText{ 64 });
+  });
+}
+
+TEST(SerializeExtensionInternedText, RepeatedTextIsWrittenAsId)
+{
+  std::vector<std::string> src{ "EURUSD", "GBPUSD", "EURUSD",
+                                "EURUSD", "GBPUSD", "USDJPY" };
+  std::vector<std::string> res{};
+  InternedTextContext<> serCtx{};
+  InternedTextContext<> desCtx{};
+  SerContext ctx;
+  serializeSymbols(ctx.createSerializer(serCtx), src);
+  serializeSymbols(ctx.createDeserializer(desCtx), res);
+
+  // container size, 3 new strings with marker and size, and 3 ids
+  EXPECT_THAT(ctx.getBufferSize(), Eq(1u + 3u * (1u + 1u + 6u) + 3u));
+  EXPECT_THAT(res, ContainerEq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionInternedText, ContextCanBeReusedForSession)
+{
+  InternedTextContext<> serCtx{};
+  InternedTextContext<> desCtx{};
+  std::vector<std::string> msg1{ "a", "b" };
+  std::vector<std::string> msg2{ "b", "c", "a" };
+  std::vector<std::string> res1{};
+  std::vector<std::string> res2{};
+
+  SerContext ctx1;
+  serializeSymbols(ctx1.createSerializer(serCtx), msg1);
+  serializeSymbols(ctx1.createDeserializer(desCtx), res1);
+  SerContext ctx2;
+  serializeSymbols(ctx2.createSerializer(serCtx), msg2);
+  serializeSymbols(ctx2.createDeserializer(desCtx), res2);
+
+  // only "c" is new in second message
+  EXPECT_THAT(ctx2.getBufferSize(), Eq(1u + 1u + (1u + 1u + 1u) + 1u));
+  EXPECT_THAT(res1, ContainerEq(msg1));
+  EXPECT_THAT(res2, ContainerEq(msg2));
+
+  // after clear, each message is independent
+  serCtx.clear();
+  desCtx.clear();
+  std::vector<std::string> res3{};
+  SerContext ctx3;
+  serializeSymbols(ctx3.createSerializer(serCtx), msg2);
+  serializeSymbols(ctx3.createDeserializer(desCtx), res3);
+  EXPECT_THAT(ctx3.getBufferSize(), Eq(1u + 3u * (1u + 1u + 1u)));
+  EXPECT_THAT(res3, ContainerEq(msg2));
+}
+
+TEST(SerializeExtensionInternedText, WhenIdDoesNotExistThenInvalidData)
+{
+  InternedTextContext<> serCtx{};
+  InternedTextContext<> desCtx{};
+  std::string src{ "abc" };
+  std::string res{};
+  SerContext ctx;
+  auto& ser = ctx.createSerializer(serCtx);
+  ser.ext(src, InternedText{ 10 });
+  ser.ext(src, InternedText{ 10 });
+  // clear deserialization dictionary after first string is read
+  auto& des = ctx.createDeserializer(desCtx);
+  des.ext(res, InternedText{ 10 });
+  desCtx.clear();
+  des.ext(res, InternedText{ 10 });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+}
+
+TEST(SerializeExtensionInternedText, WideStrings)
+{
+  InternedTextContext<std::wstring> serCtx{};
+  InternedTextContext<std::wstring> desCtx{};
+  std::wstring src{ L"wide" };
+  std::wstring res1{};
+  std::wstring res2{};
+  BasicSerializationContext<InternedTextContext<std::wstring>> ctx;
+  auto& ser = ctx.createSerializer(serCtx);
+  ser.ext(src, InternedText{ 10 });
+  ser.ext(src, InternedText{ 10 });
+  auto& des = ctx.createDeserializer(desCtx);
+  des.ext(res1, InternedText{ 10 });
+  des.ext(res2, InternedText{ 10 });
+
+  EXPECT_THAT(res1, Eq(src));
+  EXPECT_THAT(res2, Eq(src));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
@@ -23,6 +23,7 @@
 #include "serialization_test_utils.h"
 #include <bitsery/ext/pointer.h>
 #include <gmock/gmock.h>
+#include <stdexcept>
 
 using bitsery::ext::PointerLinkingContext;
 using bitsery::ext::PointerObserver;
@@ -616,3 +617,340 @@ TEST(SerializeExtensionPointer, ReferencedByPointerCanUseValueOverload)
 
   EXPECT_THAT(res, Eq(data));
 }
+
+TEST(SerializeExtensionPointer, ClearedContextCanBeReusedForNextMessage)
+{
+  // same contexts are reused for every message, e.g. by worker thread
+  PointerLinkingContext serCtx{};
+  PointerLinkingContext desCtx{};
+  for (int32_t i = 0; i < 3; ++i) {
+    int32_t data[2]{ i, i + 10 };
+    int32_t* dataPtr = &data[1];
+    int32_t res[2]{};
+    int32_t* resPtr = nullptr;
+
+    PointerLinkingContext freshCtx{};
+    SerContext freshSctx{};
+    auto& freshSer = freshSctx.createSerializer(freshCtx);
+    freshSer.ext4b(dataPtr, PointerObserver{});
+    freshSer.ext4b(data[0], ReferencedByPointer{});
+    freshSer.ext4b(data[1], ReferencedByPointer{});
+
+    serCtx.clear();
+    desCtx.clear();
+    SerContext sctx{};
+    auto& ser = sctx.createSerializer(serCtx);
+    ser.ext4b(dataPtr, PointerObserver{});
+    ser.ext4b(data[0], ReferencedByPointer{});
+    ser.ext4b(data[1], ReferencedByPointer{});
+    auto& des = sctx.createDeserializer(desCtx);
+    des.ext4b(resPtr, PointerObserver{});
+    des.ext4b(res[0], ReferencedByPointer{});
+    des.ext4b(res[1], ReferencedByPointer{});
+
+    EXPECT_THAT(sctx.buf, ::testing::ContainerEq(freshSctx.buf));
+    EXPECT_THAT(sctx.des->adapter().error(),
+                Eq(bitsery::ReaderError::NoError));
+    EXPECT_THAT(desCtx.isValid(), Eq(true));
+    EXPECT_THAT(resPtr, Eq(&res[1]));
+    EXPECT_THAT(res[1], Eq(i + 10));
+  }
+}
+
+TEST(SerializeExtensionPointer, RelativeIdEncodingCorrectlyLinksPointers)
+{
+  constexpr size_t Count = 20000;
+  std::vector<int32_t> data(Count);
+  std::vector<int32_t*> dataPtrs(Count);
+  for (size_t i = 0; i < Count; ++i) {
+    data[i] = static_cast<int32_t>(i);
+    // observer to the next object, to also test forward references
+    dataPtrs[i] = std::addressof(data[(i + 1) % Count]);
+  }
+  std::vector<int32_t> res(Count);
+  std::vector<int32_t*> resPtrs(Count);
+
+  auto writeGraph = [&data, &dataPtrs](PointerLinkingContext& plctx,
+                                       SerContext& sctx) {
+    auto& ser = sctx.createSerializer(plctx);
+    for (size_t i = 0; i < Count; ++i) {
+      ser.ext4b(data[i], ReferencedByPointer{});
+      ser.ext4b(dataPtrs[i], PointerObserver{});
+    }
+  };
+
+  PointerLinkingContext plctxAbsolute{};
+  SerContext sctxAbsolute{};
+  writeGraph(plctxAbsolute, sctxAbsolute);
+
+  PointerLinkingContext plctx{ nullptr,
+                               bitsery::ext::PointerIdEncoding::Relative };
+  SerContext sctx{};
+  writeGraph(plctx, sctx);
+  auto& des = sctx.createDeserializer(plctx);
+  for (size_t i = 0; i < Count; ++i) {
+    des.ext4b(res[i], ReferencedByPointer{});
+    des.ext4b(resPtrs[i], PointerObserver{});
+  }
+
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  EXPECT_THAT(plctx.isValid(), Eq(true));
+  EXPECT_THAT(res, ::testing::ContainerEq(data));
+  for (size_t i = 0; i < Count; ++i)
+    EXPECT_THAT(resPtrs[i], Eq(std::addressof(res[(i + 1) % Count])));
+  EXPECT_THAT(sctx.getBufferSize(),
+              ::testing::Lt(sctxAbsolute.getBufferSize() * 3 / 4));
+}
+
+TEST(SerializeExtensionPointer,
+     RelativeIdEncodingWhenIdIsBeforeFirstObjectThenInvalidPointerError)
+{
+  int16_t* res = nullptr;
+  PointerLinkingContext plctx{ nullptr,
+                               bitsery::ext::PointerIdEncoding::Relative };
+  SerContext sctx{};
+  // distance 1 from next id, but no objects are created yet
+  sctx.createSerializer(plctx).value1b(uint8_t{ 2 });
+  sctx.createDeserializer(plctx).ext2b(res, PointerObserver{});
+
+  EXPECT_THAT(sctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidPointer));
+}
+
+struct IterativeListNode
+{
+  IterativeListNode() = default;
+  IterativeListNode(uint32_t value_, IterativeListNode* next_)
+    : value{ value_ }
+    , next{ next_ }
+  {
+  }
+
+  uint32_t value{};
+  IterativeListNode* next{};
+};
+
+template<typename S>
+void
+serialize(S& s, IterativeListNode& o)
+{
+  s.value4b(o.value);
+  s.ext(o.next, bitsery::ext::PointerOwnerIterative{});
+}
+
+struct IterativeTreeNode
+{
+  IterativeTreeNode() = default;
+  IterativeTreeNode(uint8_t value_,
+                    IterativeTreeNode* left_,
+                    IterativeTreeNode* right_)
+    : value{ value_ }
+    , left{ left_ }
+    , right{ right_ }
+  {
+  }
+
+  uint8_t value{};
+  IterativeTreeNode* left{};
+  IterativeTreeNode* right{};
+};
+
+template<typename S>
+void
+serialize(S& s, IterativeTreeNode& o)
+{
+  s.value1b(o.value);
+  s.ext(o.left, bitsery::ext::PointerOwnerIterative{});
+  s.ext(o.right, bitsery::ext::PointerOwnerIterative{});
+}
+
+struct IterativeBitPackedNode
+{
+  IterativeBitPackedNode() = default;
+  IterativeBitPackedNode(bool flag_, IterativeBitPackedNode* next_)
+    : flag{ flag_ }
+    , next{ next_ }
+  {
+  }
+
+  bool flag{};
+  IterativeBitPackedNode* next{};
+};
+
+template<typename S>
+void
+serialize(S& s, IterativeBitPackedNode& o)
+{
+  s.enableBitPacking([&o](typename S::BPEnabledType& sbp) {
+    sbp.boolValue(o.flag);
+    sbp.ext(o.next, bitsery::ext::PointerOwnerIterative{});
+  });
+}
+
+TEST(SerializeExtensionPointer,
+     PointerOwnerIterativeDoesntUseRecursionForLongChains)
+{
+  // recursive serialization of this chain would overflow the stack
+  constexpr uint32_t Count = 1000000;
+  IterativeListNode* data = nullptr;
+  for (uint32_t i = 0; i < Count; ++i)
+    data = new IterativeListNode{ Count - i, data };
+  // observer to the last node
+  IterativeListNode* last = data;
+  while (last->next)
+    last = last->next;
+
+  PointerLinkingContext plctx{};
+  SerContext sctx{};
+  auto& ser = sctx.createSerializer(plctx);
+  ser.ext(data, bitsery::ext::PointerOwnerIterative{});
+  ser.ext(last, PointerObserver{});
+
+  IterativeListNode* res = nullptr;
+  IterativeListNode* resLast = nullptr;
+  auto& des = sctx.createDeserializer(plctx);
+  des.ext(res, bitsery::ext::PointerOwnerIterative{});
+  des.ext(resLast, PointerObserver{});
+
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  EXPECT_TRUE(plctx.isValid());
+  uint32_t count = 0;
+  bool valuesMatch = true;
+  IterativeListNode* resPrev = nullptr;
+  for (auto it = res; it; it = it->next) {
+    valuesMatch = valuesMatch && it->value == ++count;
+    resPrev = it;
+  }
+  EXPECT_THAT(count, Eq(Count));
+  EXPECT_TRUE(valuesMatch);
+  EXPECT_THAT(resLast, Eq(resPrev));
+
+  for (auto list : { data, res }) {
+    while (list) {
+      auto next = list->next;
+      delete list;
+      list = next;
+    }
+  }
+}
+
+TEST(SerializeExtensionPointer,
+     PointerOwnerIterativeProcessesObjectsInsideBitPackingScope)
+{
+  IterativeBitPackedNode n3{ true, nullptr };
+  IterativeBitPackedNode n2{ false, &n3 };
+  IterativeBitPackedNode n1{ true, &n2 };
+  IterativeBitPackedNode* data = &n1;
+
+  PointerLinkingContext plctx{};
+  SerContext sctx{};
+  auto& ser = sctx.createSerializer(plctx);
+  ser.ext(data, bitsery::ext::PointerOwnerIterative{});
+  ser.value1b(uint8_t{ 7 });
+
+  IterativeBitPackedNode* res = nullptr;
+  uint8_t after{};
+  auto& des = sctx.createDeserializer(plctx);
+  des.ext(res, bitsery::ext::PointerOwnerIterative{});
+  des.value1b(after);
+
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  EXPECT_TRUE(plctx.isValid());
+  EXPECT_THAT(after, Eq(7));
+  std::vector<bool> flags{};
+  for (auto it = res; it; it = it->next)
+    flags.push_back(it->flag);
+  EXPECT_THAT(flags, ::testing::ElementsAre(true, false, true));
+  while (res) {
+    auto next = res->next;
+    delete res;
+    res = next;
+  }
+}
+
+struct ThrowingIterativeNode
+{
+  ThrowingIterativeNode() = default;
+  ThrowingIterativeNode(bool throws_, ThrowingIterativeNode* next_)
+    : throws{ throws_ }
+    , next{ next_ }
+  {
+  }
+
+  bool throws{};
+  ThrowingIterativeNode* next{};
+};
+
+template<typename S>
+void
+serialize(S& s, ThrowingIterativeNode& o)
+{
+  if (o.throws)
+    throw std::runtime_error{ "cannot serialize" };
+  s.boolValue(o.throws);
+  s.ext(o.next, bitsery::ext::PointerOwnerIterative{});
+}
+
+TEST(SerializeExtensionPointer,
+     ClearedContextProcessesDeferredObjectsAfterException)
+{
+  ThrowingIterativeNode n2{ true, nullptr };
+  ThrowingIterativeNode n1{ false, &n2 };
+  ThrowingIterativeNode* data = &n1;
+
+  PointerLinkingContext plctx{};
+  SerContext sctx{};
+  auto& ser = sctx.createSerializer(plctx);
+  EXPECT_THROW(ser.ext(data, bitsery::ext::PointerOwnerIterative{}),
+               std::runtime_error);
+
+  // same serializer and context are reused for next message
+  plctx.clear();
+  n2.throws = false;
+  const auto begin = ser.adapter().writtenBytesCount();
+  ser.ext(data, bitsery::ext::PointerOwnerIterative{});
+  // two objects, each with pointer id and flag, and null pointer at the end
+  EXPECT_THAT(ser.adapter().writtenBytesCount() - begin, Eq(5u));
+}
+
+TEST(SerializeExtensionPointer, PointerOwnerIterativeWritesObjectsBreadthFirst)
+{
+  //      1
+  //    2   3
+  //  4
+  IterativeTreeNode n4{ 4, nullptr, nullptr };
+  IterativeTreeNode n3{ 3, nullptr, nullptr };
+  IterativeTreeNode n2{ 2, &n4, nullptr };
+  IterativeTreeNode n1{ 1, &n2, &n3 };
+  IterativeTreeNode* data = &n1;
+
+  PointerLinkingContext plctx{};
+  SerContext sctx{};
+  sctx.createSerializer(plctx).ext(data, bitsery::ext::PointerOwnerIterative{});
+  // pointer id, followed by object content
+  std::vector<char> expected{ 1, 1, 2, 3, 2, 4, 0, 3, 0, 0, 4, 0, 0 };
+  ASSERT_THAT(sctx.getBufferSize(), Eq(expected.size()));
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), sctx.buf.begin()));
+
+  // deserialize into existing tree, existing objects are reused, and missing
+  // objects are created
+  IterativeTreeNode* res = new IterativeTreeNode{
+    9, nullptr, new IterativeTreeNode{ 8, nullptr, nullptr }
+  };
+  sctx.createDeserializer(plctx).ext(res,
+                                     bitsery::ext::PointerOwnerIterative{});
+  EXPECT_TRUE(plctx.isValid());
+  ASSERT_THAT(res, ::testing::NotNull());
+  EXPECT_THAT(res->value, Eq(1));
+  ASSERT_THAT(res->left, ::testing::NotNull());
+  ASSERT_THAT(res->right, ::testing::NotNull());
+  EXPECT_THAT(res->left->value, Eq(2));
+  EXPECT_THAT(res->right->value, Eq(3));
+  ASSERT_THAT(res->left->left, ::testing::NotNull());
+  EXPECT_THAT(res->left->left->value, Eq(4));
+  EXPECT_THAT(res->left->right, ::testing::IsNull());
+  delete res->left->left;
+  delete res->left;
+  delete res->right;
+  delete res;
+}
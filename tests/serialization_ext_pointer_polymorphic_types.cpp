@@ -25,6 +25,7 @@
 
 #include "serialization_test_utils.h"
 #include <gmock/gmock.h>
+#include <thread>
 
 using bitsery::ext::BaseClass;
 using bitsery::ext::VirtualBaseClass;
@@ -373,3 +374,89 @@ TEST_F(SerializeExtensionPointerPolymorphicTypes,
   EXPECT_THAT(sctx.des->adapter().error(),
               Eq(bitsery::ReaderError::InvalidPointer));
 }
+
+TEST(SerializeExtensionPointerPolymorphicTypesRegistry,
+     StaticRegistryIsBuiltOnceAndSharedBetweenContexts)
+{
+  using Registry = bitsery::ext::PolymorphicHandlerRegistry<StandardRTTI>;
+  const auto& serRegistry = Registry::getStatic<TSerializer>(
+    bitsery::ext::PolymorphicClassesList<Base>{});
+  const auto& desRegistry = Registry::getStatic<TDeserializer>(
+    bitsery::ext::PolymorphicClassesList<Base>{});
+  EXPECT_THAT(&Registry::getStatic<TSerializer>(
+                bitsery::ext::PolymorphicClassesList<Base>{}),
+              Eq(&serRegistry));
+
+  // serialize and deserialize on multiple threads, each with its own context
+  std::vector<std::thread> threads{};
+  std::vector<int> results(4);
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&serRegistry, &desRegistry, &results, i]() {
+      MultipleVirtualInheritance md{ 1, 2, 3, static_cast<int8_t>(i) };
+      Base* data = &md;
+      Base* res = nullptr;
+      TContext serCtx{ PointerLinkingContext{},
+                       InheritanceContext{},
+                       PolymorphicContext<StandardRTTI>{ serRegistry } };
+      TContext desCtx{ PointerLinkingContext{},
+                       InheritanceContext{},
+                       PolymorphicContext<StandardRTTI>{ desRegistry } };
+      SerContext sctx{};
+      sctx.createSerializer(serCtx).ext(data, PointerOwner{});
+      sctx.createDeserializer(desCtx).ext(res, PointerOwner{});
+      auto* resDerived = dynamic_cast<MultipleVirtualInheritance*>(res);
+      results[i] = resDerived ? resDerived->z : -1;
+      delete res;
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+  EXPECT_THAT(results, ::testing::ElementsAre(0, 1, 2, 3));
+}
+
+TEST(SerializeExtensionPointerPolymorphicTypesRegistry,
+     WorkerThreadsReuseContextsForManyMessages)
+{
+  using Registry = bitsery::ext::PolymorphicHandlerRegistry<StandardRTTI>;
+  const auto& serRegistry = Registry::getStatic<TSerializer>(
+    bitsery::ext::PolymorphicClassesList<Base>{});
+  const auto& desRegistry = Registry::getStatic<TDeserializer>(
+    bitsery::ext::PolymorphicClassesList<Base>{});
+
+  // each worker creates contexts once, and only clears per message state
+  std::vector<std::thread> threads{};
+  std::vector<int> results(4);
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&serRegistry, &desRegistry, &results, i]() {
+      TContext serCtx{ PointerLinkingContext{},
+                       InheritanceContext{},
+                       PolymorphicContext<StandardRTTI>{ serRegistry } };
+      TContext desCtx{ PointerLinkingContext{},
+                       InheritanceContext{},
+                       PolymorphicContext<StandardRTTI>{ desRegistry } };
+      int sum = 0;
+      for (int8_t msg = 0; msg < 10; ++msg) {
+        std::get<0>(serCtx).clear();
+        std::get<1>(serCtx).clear();
+        std::get<0>(desCtx).clear();
+        std::get<1>(desCtx).clear();
+        MultipleVirtualInheritance md{ 1, 2, 3, msg };
+        Base* data = &md;
+        Base* res = nullptr;
+        SerContext sctx{};
+        sctx.createSerializer(serCtx).ext(data, PointerOwner{});
+        sctx.createDeserializer(desCtx).ext(res, PointerOwner{});
+        auto* resDerived = dynamic_cast<MultipleVirtualInheritance*>(res);
+        if (!resDerived || !std::get<0>(desCtx).isValid())
+          sum = -1000;
+        else
+          sum += resDerived->z;
+        delete res;
+      }
+      results[i] = sum + static_cast<int>(i);
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+  EXPECT_THAT(results, ::testing::ElementsAre(45, 46, 47, 48));
+}
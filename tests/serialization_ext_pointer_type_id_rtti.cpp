@@ -0,0 +1,289 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// this file is compiled with -fno-rtti (when supported by compiler)
+
+#include <bitsery/ext/pointer.h>
+#include <bitsery/ext/std_smart_ptr.h>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using bitsery::ext::PointerLinkingContext;
+using bitsery::ext::PolymorphicContext;
+using bitsery::ext::TypeIdRTTI;
+
+using PointerOwner = bitsery::ext::PointerOwnerBase<TypeIdRTTI>;
+using StdSmartPtr = bitsery::ext::StdSmartPtrBase<TypeIdRTTI>;
+
+using testing::Eq;
+
+using TContext =
+  std::tuple<PointerLinkingContext, PolymorphicContext<TypeIdRTTI>>;
+using SerContext = BasicSerializationContext<TContext>;
+
+struct Shape
+{
+  uint8_t x{};
+
+  virtual size_t polymorphicTypeId() const = 0;
+  virtual ~Shape() = default;
+};
+
+template<typename S>
+void
+serialize(S& s, Shape& o)
+{
+  s.value1b(o.x);
+}
+
+struct Circle : Shape
+{
+  uint8_t r{};
+
+  size_t polymorphicTypeId() const override;
+};
+
+template<typename S>
+void
+serialize(S& s, Circle& o)
+{
+  s.object(static_cast<Shape&>(o));
+  s.value1b(o.r);
+}
+
+struct Square : Shape
+{
+  uint16_t side{};
+
+  size_t polymorphicTypeId() const override;
+};
+
+template<typename S>
+void
+serialize(S& s, Square& o)
+{
+  s.object(static_cast<Shape&>(o));
+  s.value2b(o.side);
+}
+
+// has the same type id as Circle
+struct Triangle : Shape
+{
+  size_t polymorphicTypeId() const override;
+};
+
+template<typename S>
+void
+serialize(S& s, Triangle& o)
+{
+  s.object(static_cast<Shape&>(o));
+}
+
+namespace bitsery {
+namespace ext {
+
+template<>
+struct PolymorphicBaseClass<Shape> : PolymorphicDerivedClasses<Circle, Square>
+{
+};
+
+template<>
+struct PolymorphicTypeId<Shape> : std::integral_constant<size_t, 1>
+{
+};
+
+template<>
+struct PolymorphicTypeId<Circle> : std::integral_constant<size_t, 2>
+{
+};
+
+template<>
+struct PolymorphicTypeId<Square> : std::integral_constant<size_t, 3>
+{
+};
+
+template<>
+struct PolymorphicTypeId<Triangle> : std::integral_constant<size_t, 2>
+{
+};
+
+template<>
+struct PolymorphicTypeId<MyStruct1> : std::integral_constant<size_t, 10>
+{
+};
+
+}
+}
+
+size_t
+Circle::polymorphicTypeId() const
+{
+  return bitsery::ext::PolymorphicTypeId<Circle>::value;
+}
+
+size_t
+Square::polymorphicTypeId() const
+{
+  return bitsery::ext::PolymorphicTypeId<Square>::value;
+}
+
+size_t
+Triangle::polymorphicTypeId() const
+{
+  return bitsery::ext::PolymorphicTypeId<Triangle>::value;
+}
+
+class SerializeExtensionPointerTypeIdRTTI : public testing::Test
+{
+public:
+  TContext plctx{};
+  SerContext sctx{};
+
+  typename SerContext::TSerializer& createSerializer()
+  {
+    auto& res = sctx.createSerializer(plctx);
+    std::get<1>(plctx).clear();
+    std::get<1>(plctx).registerBasesList<SerContext::TSerializer>(
+      bitsery::ext::PolymorphicClassesList<Shape>{});
+    return res;
+  }
+
+  typename SerContext::TDeserializer& createDeserializer()
+  {
+    auto& res = sctx.createDeserializer(plctx);
+    std::get<1>(plctx).clear();
+    std::get<1>(plctx).registerBasesList<SerContext::TDeserializer>(
+      bitsery::ext::PolymorphicClassesList<Shape>{});
+    return res;
+  }
+};
+
+TEST_F(SerializeExtensionPointerTypeIdRTTI, TypeIdsAreTakenFromTypeIdTrait)
+{
+  static_assert(TypeIdRTTI::get<Shape>() == 1, "");
+  static_assert(TypeIdRTTI::get<Square>() == 3, "");
+  static_assert(TypeIdRTTI::get<int>() == 0, "");
+  // non-polymorphic types can have type id too, e.g. for memory resources
+  static_assert(TypeIdRTTI::get<MyStruct1>() == 10, "");
+  Square sq{};
+  Shape& shape = sq;
+  EXPECT_THAT(TypeIdRTTI::get(shape), Eq(3u));
+}
+
+TEST_F(SerializeExtensionPointerTypeIdRTTI, PolymorphicRawPointer)
+{
+  Square sq{};
+  sq.x = 4;
+  sq.side = 1000;
+  Shape* data = &sq;
+  createSerializer().ext(data, PointerOwner{});
+  // pointer id, derived index and data
+  EXPECT_THAT(sctx.getBufferSize(), Eq(1 + 1 + 3));
+
+  Shape* res = new Circle{};
+  createDeserializer().ext(res, PointerOwner{});
+  ASSERT_THAT(res, ::testing::NotNull());
+  ASSERT_THAT(res->polymorphicTypeId(), Eq(3u));
+  EXPECT_THAT(res->x, Eq(4));
+  EXPECT_THAT(static_cast<Square*>(res)->side, Eq(1000));
+  EXPECT_TRUE(std::get<0>(plctx).isValid());
+  delete res;
+}
+
+TEST_F(SerializeExtensionPointerTypeIdRTTI, PolymorphicSharedPointers)
+{
+  auto circle = std::make_shared<Circle>();
+  circle->x = 1;
+  circle->r = 9;
+  std::vector<std::shared_ptr<Shape>> data{ circle, circle, nullptr };
+  createSerializer().container(
+    data, 10, [](SerContext::TSerializer& s, std::shared_ptr<Shape>& p) {
+      s.ext(p, StdSmartPtr{});
+    });
+
+  std::vector<std::shared_ptr<Shape>> res{};
+  createDeserializer().container(
+    res, 10, [](SerContext::TDeserializer& s, std::shared_ptr<Shape>& p) {
+      s.ext(p, StdSmartPtr{});
+    });
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  ASSERT_THAT(res.size(), Eq(3u));
+  ASSERT_THAT(res[0], ::testing::NotNull());
+  EXPECT_THAT(res[0], Eq(res[1]));
+  EXPECT_THAT(res[2], ::testing::IsNull());
+  ASSERT_THAT(res[0]->polymorphicTypeId(), Eq(2u));
+  EXPECT_THAT(static_cast<Circle&>(*res[0]).r, Eq(9));
+  std::get<0>(plctx).clearSharedState();
+}
+
+TEST_F(SerializeExtensionPointerTypeIdRTTI, NonPolymorphicPointer)
+{
+  uint32_t value = 7;
+  uint32_t* data = &value;
+  createSerializer().ext4b(data, PointerOwner{});
+  uint32_t* res = nullptr;
+  createDeserializer().ext4b(res, PointerOwner{});
+  ASSERT_THAT(res, ::testing::NotNull());
+  EXPECT_THAT(*res, Eq(7u));
+  delete res;
+}
+
+TEST_F(SerializeExtensionPointerTypeIdRTTI,
+       WhenDerivedIndexIsNotRegisteredThenInvalidPointerError)
+{
+  auto& ser = createSerializer();
+  // pointer id
+  ser.value1b(uint8_t{ 1 });
+  // derived index, only 2 derived classes registered
+  ser.value1b(uint8_t{ 2 });
+  Shape* res = nullptr;
+  createDeserializer().ext(res, PointerOwner{});
+  EXPECT_THAT(sctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidPointer));
+  EXPECT_THAT(res, ::testing::IsNull());
+}
+
+TEST(SerializeExtensionPointerTypeIdRTTIRegistry,
+     DuplicateTypeIdsInDerivedClassesListAreDetectedAtCompileTime)
+{
+  using bitsery::ext::HasUniqueTypeIds;
+  static_assert(HasUniqueTypeIds<TypeIdRTTI, Shape, Circle, Square>::value, "");
+  static_assert(!HasUniqueTypeIds<TypeIdRTTI, Shape, Circle, Triangle>::value,
+                "");
+  // types without type id are not checked
+  static_assert(HasUniqueTypeIds<TypeIdRTTI, int, Circle, int>::value, "");
+  SUCCEED();
+}
+
+TEST(SerializeExtensionPointerTypeIdRTTIRegistry,
+     WhenDifferentClassesHaveSameTypeIdThenAbort)
+{
+  using TSerializer = SerContext::TSerializer;
+  bitsery::ext::PolymorphicHandlerRegistry<TypeIdRTTI> registry{};
+  registry.registerBasesList<TSerializer>(
+    bitsery::ext::PolymorphicClassesList<Shape>{});
+  // same class can be registered again
+  registry.registerSingleBaseBranch<TSerializer, Shape, Circle>();
+  EXPECT_DEATH(
+    (registry.registerSingleBaseBranch<TSerializer, Shape, Triangle>()), "");
+}
@@ -428,3 +428,178 @@ TEST_F(SerializeExtensionPointerWithAllocator,
   // for structures with nested pointers
   EXPECT_THAT(memRes2.deallocs.size(), Eq(1u));
 }
+
+TEST_F(SerializeExtensionPointerWithAllocator,
+       StdSharedPtrAllocatesObjectAndControlBlockTogether)
+{
+  MemResourceForTest memRes{};
+  std::get<0>(plctx).setMemResource(&memRes);
+
+  auto data = std::make_shared<MyStruct1>(4, 9);
+  std::weak_ptr<MyStruct1> dataWeak = data;
+  auto& ser = createSerializer();
+  ser.ext(data, StdSmartPtr{});
+  ser.ext(dataWeak, StdSmartPtr{});
+  std::shared_ptr<MyStruct1> res{};
+  std::weak_ptr<MyStruct1> resWeak{};
+  auto& des = createDeserializer();
+  des.ext(res, StdSmartPtr{});
+  des.ext(resWeak, StdSmartPtr{});
+
+  EXPECT_THAT(*res, Eq(*data));
+  EXPECT_THAT(resWeak.lock(), Eq(res));
+  EXPECT_THAT(memRes.allocs.size(), Eq(1u));
+  EXPECT_THAT(memRes.allocs[0].bytes, ::testing::Gt(sizeof(MyStruct1)));
+  EXPECT_THAT(memRes.allocs[0].typeId,
+              Eq(bitsery::ext::StandardRTTI::get<MyStruct1>()));
+  std::get<0>(plctx).clearSharedState();
+  res.reset();
+  // weak pointer keeps memory alive, because it is single allocation
+  EXPECT_THAT(memRes.deallocs.size(), Eq(0u));
+  resWeak.reset();
+  EXPECT_THAT(memRes.deallocs.size(), Eq(1u));
+  EXPECT_THAT(memRes.deallocs[0].ptr, Eq(memRes.allocs[0].ptr));
+}
+
+TEST_F(SerializeExtensionPointerWithAllocator,
+       StdSharedPtrPolymorphicAllocatesObjectAndControlBlockTogether)
+{
+  MemResourceForTest memRes{};
+  std::get<0>(plctx).setMemResource(&memRes);
+
+  std::shared_ptr<Base> data = std::make_shared<Derived1>(2, 1);
+  createSerializer().ext(data, StdSmartPtr{});
+  std::shared_ptr<Base> res{};
+  createDeserializer().ext(res, StdSmartPtr{});
+
+  auto dRes = dynamic_cast<Derived1*>(res.get());
+  EXPECT_THAT(dRes, ::testing::NotNull());
+  EXPECT_THAT(*dRes, Eq(*std::static_pointer_cast<Derived1>(data)));
+  EXPECT_THAT(memRes.allocs.size(), Eq(1u));
+  EXPECT_THAT(memRes.allocs[0].bytes, ::testing::Gt(sizeof(Derived1)));
+  EXPECT_THAT(memRes.allocs[0].typeId,
+              Eq(bitsery::ext::StandardRTTI::get<Derived1>()));
+  std::get<0>(plctx).clearSharedState();
+  res.reset();
+  EXPECT_THAT(memRes.deallocs.size(), Eq(1u));
+}
+
+// returns address of upstream allocation (slab block), that contains ptr
+const void*
+findSlabBlock(const std::vector<TestAllocInfo>& infos, const void* ptr)
+{
+  for (const auto& info : infos) {
+    const auto begin = static_cast<const char*>(info.ptr);
+    if (begin <= ptr && ptr < begin + info.bytes)
+      return info.ptr;
+  }
+  return nullptr;
+}
+
+struct SlabNode
+{
+  SlabNode() = default;
+  SlabNode(uint32_t value_, SlabNode* next_)
+    : value{ value_ }
+    , next{ next_ }
+  {
+  }
+
+  uint32_t value{};
+  SlabNode* next{};
+};
+
+template<typename S>
+void
+serialize(S& s, SlabNode& o)
+{
+  s.value4b(o.value);
+  s.ext(o.next, PointerObserver{});
+}
+
+TEST_F(SerializeExtensionPointerWithAllocator,
+       MemResourceSlabAllocatesObjectsOfSameTypeContiguously)
+{
+  constexpr size_t Count = 1000;
+  std::vector<SlabNode*> data{};
+  for (size_t i = 0; i < Count; ++i)
+    data.push_back(new SlabNode{ static_cast<uint32_t>(i), nullptr });
+  // link nodes in reverse order
+  for (size_t i = 1; i < Count; ++i)
+    data[i]->next = data[i - 1];
+  auto& ser = createSerializer();
+  ser.container(data, Count, [](TSerializer& s, SlabNode*& p) {
+    s.ext(p, PointerOwner{});
+  });
+
+  MemResourceForTest upstream{};
+  bitsery::ext::MemResourceSlab slab{ 4096, &upstream };
+  std::get<0>(plctx).setMemResource(&slab);
+  // e.g. object count is known from message header
+  slab.reserveObjects<SlabNode>(Count, StandardRTTI::get<SlabNode>());
+  std::vector<SlabNode*> res{};
+  createDeserializer().container(
+    res, Count, [](TDeserializer& s, SlabNode*& p) {
+      s.ext(p, PointerOwner{});
+    });
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  ASSERT_THAT(res.size(), Eq(Count));
+  for (size_t i = 0; i < Count; ++i) {
+    EXPECT_THAT(res[i]->value, Eq(i));
+    EXPECT_THAT(res[i]->next, Eq(i ? res[i - 1] : nullptr));
+    // nodes are stored next to each other
+    EXPECT_THAT(res[i], Eq(res[0] + i));
+  }
+  // slab blocks and internal data, are allocated from upstream with typeId 0,
+  // reserved block is enough for all nodes, so no default size block is added
+  for (const auto& info : upstream.allocs) {
+    EXPECT_THAT(info.typeId, Eq(0u));
+    EXPECT_THAT(info.bytes, ::testing::Ne(4096u));
+  }
+  EXPECT_THAT(findSlabBlock(upstream.allocs, res[0]), ::testing::NotNull());
+
+  // deallocation does nothing, memory is freed all at once
+  EXPECT_THAT(findSlabBlock(upstream.deallocs, res[0]), ::testing::IsNull());
+  slab.release();
+  EXPECT_THAT(findSlabBlock(upstream.deallocs, res[0]), ::testing::NotNull());
+  std::get<0>(plctx).setMemResource(nullptr);
+  for (auto p : data)
+    delete p;
+}
+
+TEST(MemResourceSlab, AllocatesAlignedMemoryAndGrowsWithNewBlocks)
+{
+  MemResourceForTest upstream{};
+  {
+    bitsery::ext::MemResourceSlab slab{ 64, &upstream };
+    auto p1 = slab.allocate(10, 1, 1);
+    auto p2 = slab.allocate(8, 8, 1);
+    EXPECT_THAT(reinterpret_cast<std::uintptr_t>(p2) % 8, Eq(0u));
+    EXPECT_THAT(static_cast<char*>(p2) - static_cast<char*>(p1),
+                ::testing::Ge(10));
+    auto block1 = findSlabBlock(upstream.allocs, p1);
+    ASSERT_THAT(block1, ::testing::NotNull());
+    EXPECT_THAT(upstream.allocs.back().bytes, Eq(64u));
+    EXPECT_THAT(findSlabBlock(upstream.allocs, p2), Eq(block1));
+    // different type id uses different block
+    auto p3 = slab.allocate(8, 8, 2);
+    auto block3 = findSlabBlock(upstream.allocs, p3);
+    ASSERT_THAT(block3, ::testing::NotNull());
+    EXPECT_THAT(block3, ::testing::Ne(block1));
+    // bigger than block size
+    auto p4 = slab.allocate(100, 4, 1);
+    EXPECT_THAT(findSlabBlock(upstream.allocs, p4), ::testing::NotNull());
+    EXPECT_THAT(findSlabBlock(upstream.allocs, p4), ::testing::Ne(block1));
+    // allocations with type id 0 are forwarded
+    auto p5 = slab.allocate(16, 4, 0);
+    EXPECT_THAT(upstream.allocs.back().ptr, Eq(p5));
+    slab.deallocate(p5, 16, 4, 0);
+    EXPECT_THAT(upstream.deallocs.back().ptr, Eq(p5));
+    // slab memory is not deallocated
+    slab.deallocate(p4, 100, 4, 1);
+    slab.deallocate(p3, 8, 8, 2);
+    EXPECT_THAT(findSlabBlock(upstream.deallocs, p3), ::testing::IsNull());
+    EXPECT_THAT(findSlabBlock(upstream.deallocs, p4), ::testing::IsNull());
+  }
+  EXPECT_THAT(upstream.deallocs.size(), Eq(upstream.allocs.size()));
+}
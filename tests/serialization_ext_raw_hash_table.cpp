@@ -0,0 +1,190 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <bitsery/ext/raw_hash_table.h>
+
+#include "serialization_test_utils.h"
+#include <gmock/gmock.h>
+
+using RawHashTable = bitsery::ext::RawHashTable;
+
+using testing::Eq;
+
+// minimal open-addressing table with linear probing
+class ProbingTable
+{
+public:
+  struct Slot
+  {
+    uint32_t used;
+    int32_t key;
+    int32_t value;
+  };
+
+  explicit ProbingTable(size_t slotCount = 8)
+    : _slots(slotCount, Slot{ 0, 0, 0 })
+  {
+  }
+
+  void insert(int32_t key, int32_t value)
+  {
+    auto& slot = _slots[find(key)];
+    if (!slot.used)
+      ++_size;
+    slot = Slot{ 1, key, value };
+  }
+
+  const Slot* get(int32_t key) const
+  {
+    auto& slot = _slots[find(key)];
+    return slot.used ? &slot : nullptr;
+  }
+
+  size_t size() const { return _size; }
+
+private:
+  friend struct bitsery::traits::RawHashTableTraits<ProbingTable>;
+
+  size_t find(int32_t key) const
+  {
+    auto i = static_cast<size_t>(static_cast<uint32_t>(key) * 2654435761u) &
+             (_slots.size() - 1);
+    while (_slots[i].used && _slots[i].key != key)
+      i = (i + 1) & (_slots.size() - 1);
+    return i;
+  }
+
+  std::vector<Slot> _slots;
+  size_t _size{};
+};
+
+namespace bitsery {
+namespace traits {
+
+template<>
+struct RawHashTableTraits<ProbingTable>
+{
+  using TSlot = ProbingTable::Slot;
+
+  static size_t size(const ProbingTable& obj) { return obj._size; }
+  static size_t slotCount(const ProbingTable& obj)
+  {
+    return obj._slots.size();
+  }
+  static const TSlot* slots(const ProbingTable& obj)
+  {
+    return obj._slots.data();
+  }
+  static TSlot* prepare(ProbingTable& obj, size_t slotCount)
+  {
+    // slot count must be power of two
+    if (slotCount == 0 || (slotCount & (slotCount - 1)) != 0)
+      return nullptr;
+    obj._slots.resize(slotCount);
+    return obj._slots.data();
+  }
+  static bool finish(ProbingTable& obj, size_t size)
+  {
+    size_t used = 0;
+    for (auto& slot : obj._slots)
+      used += slot.used ? 1u : 0u;
+    obj._size = size;
+    return used == size;
+  }
+  static void clear(ProbingTable& obj) { obj = ProbingTable{}; }
+};
+
+}
+}
+
+TEST(SerializeExtensionRawHashTable, SlotsAreWrittenDirectly)
+{
+  ProbingTable src{ 16 };
+  for (auto i = 0; i < 10; ++i)
+    src.insert(i * 7, -i);
+  ProbingTable res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, RawHashTable{ 16 });
+  ctx.createDeserializer().ext(res, RawHashTable{ 16 });
+
+  EXPECT_THAT(ctx.getBufferSize(), Eq(2 + 16 * sizeof(ProbingTable::Slot)));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+  EXPECT_THAT(res.size(), Eq(10u));
+  for (auto i = 0; i < 10; ++i) {
+    auto slot = res.get(i * 7);
+    ASSERT_THAT(slot, ::testing::NotNull());
+    EXPECT_THAT(slot->value, Eq(-i));
+  }
+}
+
+TEST(SerializeExtensionRawHashTable, WhenSlotCountIsMoreThanMaxThenInvalidData)
+{
+  ProbingTable src{ 16 };
+  src.insert(1, 1);
+  ProbingTable res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, RawHashTable{ 16 });
+  ctx.createDeserializer().ext(res, RawHashTable{ 8 });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+  EXPECT_THAT(res.size(), Eq(0u));
+}
+
+TEST(SerializeExtensionRawHashTable, WhenTableIsNotValidThenInvalidData)
+{
+  ProbingTable src{ 8 };
+  src.insert(1, 1);
+  src.insert(2, 2);
+  ProbingTable res{};
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, RawHashTable{ 8 });
+  // corrupt `used` flag of all slots
+  for (auto i = 2u; i < ctx.buf.size(); i += sizeof(ProbingTable::Slot))
+    ctx.buf[i] = 0;
+  ctx.createDeserializer().ext(res, RawHashTable{ 8 });
+
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+  EXPECT_THAT(res.size(), Eq(0u));
+}
+
+TEST(SerializeExtensionRawHashTable, WhenNotEnoughDataThenTableIsCleared)
+{
+  ProbingTable src{ 8 };
+  src.insert(1, 1);
+  ProbingTable res{};
+  res.insert(5, 5);
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, RawHashTable{ 8 });
+  bitsery::Deserializer<Reader> des{ ctx.buf.begin(),
+                                    ctx.getBufferSize() - 1 };
+  des.ext(res, RawHashTable{ 8 });
+
+  EXPECT_THAT(des.adapter().error(),
+              Eq(bitsery::ReaderError::DataOverflow));
+  EXPECT_THAT(res.size(), Eq(0u));
+}
@@ -0,0 +1,209 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "serialization_test_utils.h"
+#include <bitsery/brief_syntax.h>
+#include <bitsery/brief_syntax/vector.h>
+#include <bitsery/ext/compact_value.h>
+#include <bitsery/ext/growable.h>
+#include <bitsery/ext/schema_fingerprint.h>
+#include <bitsery/traits/string.h>
+#include <bitsery/traits/vector.h>
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+using bitsery::ext::SchemaFingerprint;
+using bitsery::ext::schemaFingerprint;
+
+namespace {
+
+struct PointV1
+{
+  int32_t x;
+  int32_t y;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.value4b(x);
+    s.value4b(y);
+  }
+};
+
+// same fields, different value size
+struct PointV2
+{
+  int32_t x;
+  int64_t y;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.value4b(x);
+    s.value8b(y);
+  }
+};
+
+struct Shape
+{
+  std::string name;
+  std::vector<PointV1> points;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.text1b(name, 100);
+    s.container(points, 1000);
+  }
+};
+
+struct ShapeV2
+{
+  std::string name;
+  std::vector<PointV2> points;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.text1b(name, 100);
+    s.container(points, 1000);
+  }
+};
+
+struct Tree
+{
+  int32_t value;
+  std::vector<Tree> children;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.value4b(value);
+    s.ext(*this, bitsery::ext::Growable{}, [](S& s, Tree& o) {
+      s.container(o.children, 100);
+    });
+  }
+};
+
+struct RegionPoint
+{
+  int32_t x;
+  int32_t y;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s.fixedSizeRegion(8, [this](typename S::FixedRegionType& r) {
+      r.value4b(x);
+      r.value4b(y);
+    });
+  }
+};
+
+struct CompactPoint
+{
+  int32_t x;
+  int32_t y;
+  template<typename S>
+  void serialize(S& s)
+  {
+    // extension passed as lvalue
+    const bitsery::ext::CompactValue compact{};
+    s.ext4b(x, compact);
+    s.ext4b(y, compact);
+  }
+};
+
+struct BriefPoint
+{
+  int32_t x;
+  int32_t y;
+  template<typename S>
+  void serialize(S& s)
+  {
+    s(x, y);
+  }
+};
+
+}
+
+TEST(SerializeExtensionSchemaFingerprint, SameSchemaHasSameFingerprint)
+{
+  EXPECT_THAT(schemaFingerprint<PointV1>(), Eq(schemaFingerprint<PointV1>()));
+  // brief syntax produce same calls
+  EXPECT_THAT(schemaFingerprint<BriefPoint>(),
+              Eq(schemaFingerprint<PointV1>()));
+}
+
+TEST(SerializeExtensionSchemaFingerprint, DifferentSchemaHasDifferentFingerprint)
+{
+  EXPECT_THAT(schemaFingerprint<PointV1>(),
+              Ne(schemaFingerprint<PointV2>()));
+  // container element layout is part of fingerprint
+  EXPECT_THAT(schemaFingerprint<Shape>(), Ne(schemaFingerprint<ShapeV2>()));
+}
+
+TEST(SerializeExtensionSchemaFingerprint,
+     SupportsSameFunctionsAsSerializer)
+{
+  EXPECT_THAT(schemaFingerprint<RegionPoint>(),
+              Ne(schemaFingerprint<PointV1>()));
+  EXPECT_THAT(schemaFingerprint<CompactPoint>(),
+              Ne(schemaFingerprint<PointV1>()));
+
+  SerializationContext ctx;
+  ctx.createSerializer().object(RegionPoint{ 1, 2 });
+  RegionPoint res{};
+  ctx.createDeserializer().object(res);
+  EXPECT_THAT(res.y, Eq(2));
+}
+
+TEST(SerializeExtensionSchemaFingerprint, RecursiveTypesAreSupported)
+{
+  EXPECT_THAT(schemaFingerprint<Tree>(), Ne(schemaFingerprint<PointV1>()));
+}
+
+TEST(SerializeExtensionSchemaFingerprint, WhenFingerprintMatchesThenDeserialize)
+{
+  SerializationContext ctx;
+  Shape data{ "triangle", { { 1, 2 }, { 3, 4 }, { 5, 6 } } };
+  ctx.createSerializer().ext(data, SchemaFingerprint{});
+  EXPECT_THAT(ctx.getBufferSize(),
+              Eq(8 + 1 + data.name.size() + 1 + 3 * 8));
+
+  Shape res{};
+  ctx.createDeserializer().ext(res, SchemaFingerprint{});
+  EXPECT_THAT(res.name, Eq(data.name));
+  EXPECT_THAT(res.points.size(), Eq(3u));
+  EXPECT_THAT(res.points[2].y, Eq(6));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeExtensionSchemaFingerprint,
+     WhenFingerprintMismatchThenInvalidDataWithoutDecoding)
+{
+  SerializationContext ctx;
+  Shape data{ "triangle", { { 1, 2 }, { 3, 4 }, { 5, 6 } } };
+  ctx.createSerializer().ext(data, SchemaFingerprint{});
+
+  ShapeV2 res{};
+  ctx.createDeserializer().ext(res, SchemaFingerprint{});
+  EXPECT_THAT(ctx.des->adapter().error(),
+              Eq(bitsery::ReaderError::InvalidData));
+  EXPECT_THAT(res.name, Eq(""));
+  EXPECT_THAT(res.points.size(), Eq(0u));
+}
@@ -149,3 +149,114 @@ TYPED_TEST(SerializeExtensionStdMap, SerializeAndDeserializeEquals)
   ctx1.createDeserializer().object(this->res);
   EXPECT_THAT(this->res, Eq(this->src));
 }
+
+// hash map without emplace_hint, that is plugged in via traits
+struct IndexMap
+{
+  using key_type = int32_t;
+  using mapped_type = int32_t;
+  using iterator = std::unordered_map<int32_t, int32_t>::iterator;
+  using const_iterator = std::unordered_map<int32_t, int32_t>::const_iterator;
+
+  void reserve(size_t size)
+  {
+    reservedSize = size;
+    data.reserve(size);
+  }
+  void clear() { data.clear(); }
+  std::pair<iterator, bool> emplace(int32_t key, int32_t value)
+  {
+    return data.emplace(key, value);
+  }
+  size_t size() const { return data.size(); }
+  iterator begin() { return data.begin(); }
+  iterator end() { return data.end(); }
+  const_iterator begin() const { return data.begin(); }
+  const_iterator end() const { return data.end(); }
+
+  std::unordered_map<int32_t, int32_t> data{};
+  size_t reservedSize{};
+};
+
+namespace bitsery {
+namespace traits {
+
+template<>
+struct AssociativeContainerTraits<IndexMap>
+{
+  static void clear(IndexMap& obj) { obj.clear(); }
+  static void reserve(IndexMap& obj, size_t size) { obj.reserve(size); }
+  template<typename It>
+  static It emplace(IndexMap& obj, It, int32_t&& key, int32_t&& value)
+  {
+    return obj.emplace(key, value).first;
+  }
+};
+
+}
+}
+
+TEST(SerializeExtensionStdMap, CustomContainerViaAssociativeContainerTraits)
+{
+  IndexMap src{};
+  src.emplace(1, -1);
+  src.emplace(8, -8);
+  src.emplace(45, -45);
+  IndexMap res{};
+  res.emplace(3, 3);
+
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.ext(src, StdMap{ 10 }, [](decltype(ser)& s, int32_t& k, int32_t& v) {
+    s.value4b(k);
+    s.value4b(v);
+  });
+  auto& des = ctx.createDeserializer();
+  des.ext(res, StdMap{ 10 }, [](decltype(des)& d, int32_t& k, int32_t& v) {
+    d.value4b(k);
+    d.value4b(v);
+  });
+
+  EXPECT_THAT(res.data, Eq(src.data));
+  EXPECT_THAT(res.reservedSize, Eq(3u));
+}
+
+#if __cplusplus >= 201703L
+
+TEST(SerializeExtensionStdMap, WhenReuseNodesThenExistingNodesAreReused)
+{
+  std::map<int32_t, std::string> src{ { 1, "one" }, { 2, "two" } };
+  std::map<int32_t, std::string> res{ { 5, "five" }, { 6, "six" }, { 7, "7" } };
+  std::vector<const std::string*> nodes{};
+  for (auto& v : res)
+    nodes.push_back(&v.second);
+  auto fnc = [](auto& s, int32_t& key, std::string& value) {
+    s.value4b(key);
+    s.text1b(value, 10);
+  };
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, StdMap{ 10 }, fnc);
+  ctx.createDeserializer().ext(res, StdMap{ 10, true }, fnc);
+
+  EXPECT_THAT(res, Eq(src));
+  EXPECT_THAT(nodes, testing::Contains(&res.at(1)));
+  EXPECT_THAT(nodes, testing::Contains(&res.at(2)));
+}
+
+TEST(SerializeExtensionStdMap, WhenReuseNodesAndNotEnoughNodesThenNewAreCreated)
+{
+  auto src = createData<std::unordered_map<std::string, MyStruct1>>();
+  std::unordered_map<std::string, MyStruct1> res{ { "a", MyStruct1{} } };
+  auto fnc = [](auto& s, std::string& key, MyStruct1& value) {
+    s.text1b(key, 100);
+    s.object(value);
+  };
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext(src, StdMap{ 10 }, fnc);
+  ctx.createDeserializer().ext(res, StdMap{ 10, true }, fnc);
+  EXPECT_THAT(res, Eq(src));
+}
+
+#endif
@@ -80,3 +80,48 @@ TEST(SerializeExtensionStdSet, FunctionSyntax)
     r1, StdSet{ 10 }, [](decltype(des)& des, int32_t& v) { des.value4b(v); });
   EXPECT_THAT(r1, Eq(t1));
 }
+
+#if __cplusplus >= 201703L
+
+TEST(SerializeExtensionStdSet, WhenReuseNodesThenExistingNodesAreReused)
+{
+  std::set<int32_t> src{ 4, 8, 48 };
+  std::set<int32_t> res{ 78, 74, 154, 8 };
+  std::vector<const int32_t*> nodes{};
+  for (auto& v : res)
+    nodes.push_back(&v);
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext4b(src, StdSet{ 10 });
+  ctx.createDeserializer().ext4b(res, StdSet{ 10, true });
+
+  EXPECT_THAT(res, Eq(src));
+  for (auto& v : res)
+    EXPECT_THAT(nodes, testing::Contains(&v));
+}
+
+struct StatefulCompare
+{
+  bool descending{};
+
+  bool operator()(int32_t lhs, int32_t rhs) const
+  {
+    return descending ? rhs < lhs : lhs < rhs;
+  }
+};
+
+TEST(SerializeExtensionStdSet, WhenReuseNodesThenComparatorIsPreserved)
+{
+  std::set<int32_t, StatefulCompare> src{ { 4, 8, 48 },
+                                          StatefulCompare{ true } };
+  std::set<int32_t, StatefulCompare> res{ { 78, 74 }, StatefulCompare{ true } };
+
+  SerializationContext ctx;
+  ctx.createSerializer().ext4b(src, StdSet{ 10 });
+  ctx.createDeserializer().ext4b(res, StdSet{ 10, true });
+
+  EXPECT_TRUE(res.key_comp().descending);
+  EXPECT_THAT(res, testing::ElementsAre(48, 8, 4));
+}
+
+#endif
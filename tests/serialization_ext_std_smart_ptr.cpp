@@ -743,6 +743,68 @@ TEST_F(SerializeExtensionStdSmartSharedPtr,
   EXPECT_THAT(baseRes1.use_count(), Eq(0));
 }
 
+TEST_F(SerializeExtensionStdSmartSharedPtr,
+       SameObjectViaDifferentBaseClassesIsSerializedOnce)
+{
+  std::shared_ptr<MoreDerived> data{ new MoreDerived{ 3, 78, 4 } };
+  std::shared_ptr<Base> baseData{ data };
+  std::weak_ptr<Derived> derivedData{ data };
+  // virtual base class is not at the same address as derived class
+  EXPECT_THAT(static_cast<const void*>(baseData.get()),
+              Ne(static_cast<const void*>(data.get())));
+
+  auto& ser = createSerializer();
+  ser.ext(baseData, StdSmartPtr{});
+  ser.ext(derivedData, StdSmartPtr{});
+  ser.ext(data, StdSmartPtr{});
+
+  std::shared_ptr<Base> baseRes{};
+  std::weak_ptr<Derived> derivedRes{};
+  std::shared_ptr<MoreDerived> res{};
+  auto& des = createDeserializer();
+  des.ext(baseRes, StdSmartPtr{});
+  des.ext(derivedRes, StdSmartPtr{});
+  des.ext(res, StdSmartPtr{});
+
+  // 1b linking context + 1b dynamic type info + 3b MoreDerived object
+  // 1b linking context for 2nd and 3rd time
+  EXPECT_THAT(getBufferSize(), Eq(7));
+  EXPECT_THAT(sctx.des->adapter().error(), Eq(bitsery::ReaderError::NoError));
+  EXPECT_THAT(res->x, Eq(3));
+  EXPECT_THAT(res->y, Eq(78));
+  EXPECT_THAT(res->z, Eq(4));
+  EXPECT_THAT(baseRes.get(), Eq(static_cast<Base*>(res.get())));
+  EXPECT_THAT(derivedRes.lock().get(), Eq(static_cast<Derived*>(res.get())));
+  clearSharedState();
+  EXPECT_THAT(res.use_count(), Eq(2));
+  EXPECT_TRUE(isPointerContextValid());
+}
+
+TEST_F(SerializeExtensionStdSmartSharedPtr,
+       SameObjectViaDifferentBaseClassesWeakPtrFirst)
+{
+  std::shared_ptr<Derived> data{ new Derived{ 5, 6 } };
+  std::weak_ptr<Derived> derivedData{ data };
+  std::shared_ptr<Base> baseData{ data };
+
+  auto& ser = createSerializer();
+  ser.ext(derivedData, StdSmartPtr{});
+  ser.ext(baseData, StdSmartPtr{});
+
+  std::weak_ptr<Derived> derivedRes{};
+  std::shared_ptr<Base> baseRes{};
+  auto& des = createDeserializer();
+  des.ext(derivedRes, StdSmartPtr{});
+  des.ext(baseRes, StdSmartPtr{});
+
+  auto res = derivedRes.lock();
+  EXPECT_THAT(res, ::testing::NotNull());
+  EXPECT_THAT(res->x, Eq(5));
+  EXPECT_THAT(res->y, Eq(6));
+  EXPECT_THAT(baseRes.get(), Eq(static_cast<Base*>(res.get())));
+  EXPECT_TRUE(isPointerContextValid());
+}
+
 struct TestSharedFromThis
   : public std::enable_shared_from_this<TestSharedFromThis>
 {
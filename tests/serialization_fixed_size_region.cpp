@@ -0,0 +1,181 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "serialization_test_utils.h"
+#include <bitsery/adapter/stream.h>
+#include <bitsery/ext/growable.h>
+#include <bitsery/traits/list.h>
+#include <gmock/gmock.h>
+#include <sstream>
+
+using namespace testing;
+
+using TFixedRegion = SerializationContext::TDeserializer::FixedRegionType;
+
+TEST(SerializeFixedSizeRegion, BufferAdapterReadsRegionWithUncheckedAdapter)
+{
+  static_assert(
+    !TFixedRegion::TConfig::CheckAdapterErrors,
+    "region of checked buffer adapter should be read without bounds checks");
+  static_assert(TFixedRegion::TConfig::CheckDataErrors,
+                "data errors are still checked");
+
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.fixedSizeRegion(
+    MyStruct1::SIZE + 2,
+    [](SerializationContext::TSerializer::FixedRegionType& ser) {
+      ser.object(MyStruct1{ 7, 8 });
+      ser.value2b(uint16_t{ 9 });
+    });
+  ser.value1b(uint8_t{ 10 });
+
+  MyStruct1 res1{};
+  uint16_t res2{};
+  uint8_t res3{};
+  auto& des = ctx.createDeserializer();
+  des.fixedSizeRegion(MyStruct1::SIZE + 2,
+                      [&res1, &res2](TFixedRegion& des) {
+                        des.object(res1);
+                        des.value2b(res2);
+                      });
+  des.value1b(res3);
+  EXPECT_THAT(res1, Eq(MyStruct1{ 7, 8 }));
+  EXPECT_THAT(res2, Eq(9));
+  EXPECT_THAT(res3, Eq(10));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeFixedSizeRegion, WhenReadingPastRegionEndThenDataOverflow)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.value4b(uint32_t{ 7 });
+  ser.value4b(uint32_t{ 8 });
+
+  uint32_t res1{};
+  uint32_t res2{};
+  auto& des = ctx.createDeserializer();
+  // region size is wrong, second value is outside of region
+  des.fixedSizeRegion(4, [&res1, &res2](TFixedRegion& des) {
+    des.value4b(res1);
+    des.value4b(res2);
+  });
+  EXPECT_THAT(res1, Eq(7u));
+  EXPECT_THAT(res2, Eq(0u));
+  EXPECT_THAT(des.adapter().error(), Eq(bitsery::ReaderError::DataOverflow));
+}
+
+TEST(SerializeFixedSizeRegion, WhenNotEnoughDataThenRegionIsNotRead)
+{
+  SerializationContext ctx;
+  ctx.createSerializer().object(MyStruct1{ 7, 8 });
+
+  bool invoked = false;
+  auto& des = ctx.createDeserializer();
+  des.fixedSizeRegion(MyStruct1::SIZE + 1,
+                      [&invoked](TFixedRegion&) { invoked = true; });
+  EXPECT_THAT(invoked, Eq(false));
+  EXPECT_THAT(des.adapter().error(), Eq(bitsery::ReaderError::DataOverflow));
+}
+
+TEST(SerializeFixedSizeRegion, ContextIsAvailableInRegion)
+{
+  int ctxValue = 5;
+  BasicSerializationContext<int> ctx;
+  ctx.createSerializer(ctxValue).value4b(int32_t{ 1 });
+
+  int* regionCtx = nullptr;
+  using TRegion =
+    BasicSerializationContext<int>::TDeserializer::FixedRegionType;
+  ctx.createDeserializer(ctxValue).fixedSizeRegion(
+    4, [&regionCtx](TRegion& des) {
+      regionCtx = &des.context<int>();
+      des.skipValue4b();
+    });
+  EXPECT_THAT(regionCtx, Eq(&ctxValue));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeFixedSizeRegion, StreamAdapterUsesSameDeserializer)
+{
+  using TDes = bitsery::Deserializer<bitsery::InputStreamAdapter>;
+  static_assert(std::is_same<TDes::FixedRegionType, TDes>::value, "");
+
+  std::stringstream stream{};
+  bitsery::Serializer<bitsery::OutputStreamAdapter> ser{ stream };
+  ser.value4b(int32_t{ 3 });
+  ser.adapter().flush();
+
+  int32_t res{};
+  TDes des{ stream };
+  des.fixedSizeRegion(4, [&res](TDes& des) { des.value4b(res); });
+  EXPECT_THAT(res, Eq(3));
+  EXPECT_THAT(des.adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeFixedSizeRegion, NonContiguousContainerOfValuesIsCheckedOnce)
+{
+  SerializationContext ctx;
+  std::list<uint16_t> data{ 1, 2, 3, 4, 5 };
+  ctx.createSerializer().container2b(data, 10);
+  std::list<uint16_t> res{};
+  auto& des = ctx.createDeserializer();
+  des.container2b(res, 10);
+  EXPECT_THAT(res, ContainerEq(data));
+  EXPECT_THAT(des.adapter().isCompletedSuccessfully(), Eq(true));
+
+  SerializationContext ctxTruncated;
+  ctxTruncated.createSerializer().container2b(data, 10);
+  // last element is not fully written
+  ctxTruncated.buf.resize(ctxTruncated.getBufferSize() - 1);
+  std::list<uint16_t> resTruncated{};
+  bitsery::Deserializer<Reader> desTruncated{ ctxTruncated.buf.begin(),
+                                              ctxTruncated.buf.size() };
+  desTruncated.container2b(resTruncated, 10);
+  EXPECT_THAT(desTruncated.adapter().error(),
+              Eq(bitsery::ReaderError::DataOverflow));
+  EXPECT_THAT(resTruncated, ElementsAre(1, 2, 3, 4, 0));
+}
+
+TEST(SerializeFixedSizeRegion,
+     NonContiguousContainerOfValuesIsZeroFilledAtTheEndOfGrowableSession)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  // older version, that has only two elements
+  ser.ext(
+    uint8_t{}, bitsery::ext::Growable{}, [](decltype(ser)& ser, uint8_t&) {
+      ser.value1b(uint8_t{ 3 });
+      ser.value2b(uint16_t{ 1 });
+      ser.value2b(uint16_t{ 2 });
+    });
+
+  std::list<uint16_t> res{ 7, 7, 7 };
+  uint8_t dummy{};
+  auto& des = ctx.createDeserializer();
+  des.ext(dummy,
+          bitsery::ext::Growable{},
+          [&res](decltype(des)& des, uint8_t&) { des.container2b(res, 10); });
+  EXPECT_THAT(res, ElementsAre(1, 2, 0));
+  EXPECT_THAT(des.adapter().isCompletedSuccessfully(), Eq(true));
+}
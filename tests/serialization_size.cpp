@@ -21,7 +21,9 @@
 // SOFTWARE.
 
 #include "serialization_test_utils.h"
+#include <bitsery/adapter/stream.h>
 #include <gmock/gmock.h>
+#include <sstream>
 
 using testing::Eq;
 
@@ -66,3 +68,96 @@ TEST(SerializeSize, WhenGreaterThan16383Then4Bytes)
   EXPECT_TRUE(SerializeDeserializeContainerSize(ctx2, 66384));
   EXPECT_THAT(ctx2.getBufferSize(), Eq(4u));
 }
+
+struct LargeSizesConfig : public bitsery::DefaultConfig
+{
+  static constexpr bool SupportLargeSizes = true;
+};
+
+using LargeSizesWriter = bitsery::OutputBufferAdapter<Buffer, LargeSizesConfig>;
+using LargeSizesReader = bitsery::InputBufferAdapter<Buffer, LargeSizesConfig>;
+
+TEST(SerializeSize, WhenLargeSizesEnabledThenSizesFrom2Pow30UseMarkerAnd8Bytes)
+{
+  Buffer buf{};
+  LargeSizesWriter w{ buf };
+  bitsery::details::writeSize(w, 0x3FFFFFFFu);
+  bitsery::details::writeSize(w, 0x40000000u);
+  EXPECT_THAT(w.writtenBytesCount(), Eq(4u + 10u));
+  EXPECT_THAT(static_cast<uint8_t>(buf[4]), Eq(0x80u));
+  EXPECT_THAT(static_cast<uint8_t>(buf[5]), Eq(0x00u));
+
+  LargeSizesReader r{ buf.begin(), w.writtenBytesCount() };
+  size_t res1{};
+  size_t res2{};
+  bitsery::details::readSize(r, res1, 0x40000000u, std::true_type{});
+  bitsery::details::readSize(r, res2, 0x40000000u, std::true_type{});
+  EXPECT_THAT(res1, Eq(0x3FFFFFFFu));
+  EXPECT_THAT(res2, Eq(0x40000000u));
+  EXPECT_TRUE(r.isCompletedSuccessfully());
+}
+
+TEST(SerializeSize, WhenLargeSizesEnabledThenDataWithoutItIsReadable)
+{
+  SerializationContext ctx;
+  EXPECT_TRUE(SerializeDeserializeContainerSize(ctx, 66384));
+  LargeSizesReader r{ ctx.buf.begin(), ctx.getBufferSize() };
+  size_t res{};
+  bitsery::details::readSize(r, res, 66384, std::true_type{});
+  EXPECT_THAT(res, Eq(66384u));
+}
+
+TEST(SerializeSize, WhenLargeSizeIsMoreThanMaxSizeThenInvalidData)
+{
+  Buffer buf{};
+  LargeSizesWriter w{ buf };
+  bitsery::details::writeSize(w, 0x40000000u);
+  LargeSizesReader r{ buf.begin(), w.writtenBytesCount() };
+  size_t res{};
+  bitsery::details::readSize(r, res, 0x3FFFFFFFu, std::true_type{});
+  EXPECT_THAT(res, Eq(0u));
+  EXPECT_THAT(r.error(), Eq(bitsery::ReaderError::InvalidData));
+}
+
+struct BigEndianConfig : public bitsery::DefaultConfig
+{
+  static constexpr bitsery::EndiannessType Endianness =
+    bitsery::EndiannessType::BigEndian;
+};
+
+template<typename Config>
+void
+ExpectBufferAdapterSizesSameAsGeneric()
+{
+  const std::vector<size_t> sizes{ 0,     1,     127,        128,       255,
+                                   16383, 16384, 0x12345678, 0x3FFFFFFF, 5 };
+  // buffer adapter uses fast path, stream adapter uses generic path
+  Buffer buf{};
+  bitsery::OutputBufferAdapter<Buffer, Config> bw{ buf };
+  std::stringstream stream{};
+  bitsery::BasicOutputStreamAdapter<char, Config, std::char_traits<char>> sw{
+    stream
+  };
+  for (auto size : sizes) {
+    bitsery::details::writeSize(bw, size);
+    bitsery::details::writeSize(sw, size);
+  }
+  buf.resize(bw.writtenBytesCount());
+  const auto str = stream.str();
+  EXPECT_THAT(buf, testing::ElementsAreArray(str.begin(), str.end()));
+
+  // last sizes are read by generic path, because less than 4 bytes left
+  bitsery::InputBufferAdapter<Buffer, Config> r{ buf.begin(), buf.size() };
+  for (auto size : sizes) {
+    size_t res{};
+    bitsery::details::readSize(r, res, 0x3FFFFFFF, std::true_type{});
+    EXPECT_THAT(res, Eq(size));
+  }
+  EXPECT_TRUE(r.isCompletedSuccessfully());
+}
+
+TEST(SerializeSize, BufferAdapterReadsAndWritesSameAsGenericPath)
+{
+  ExpectBufferAdapterSizesSameAsGeneric<bitsery::DefaultConfig>();
+  ExpectBufferAdapterSizesSameAsGeneric<BigEndianConfig>();
+}
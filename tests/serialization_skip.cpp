@@ -0,0 +1,124 @@
+// MIT License
+//
+// Copyright (c) 2017 Mindaugas Vinkelis
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "serialization_test_utils.h"
+#include <bitsery/traits/string.h>
+#include <bitsery/traits/vector.h>
+#include <gmock/gmock.h>
+
+using namespace testing;
+
+TEST(SerializeSkip, SkipValuesAndText)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.value4b(uint32_t{ 5 });
+  ser.text1b(std::string{ "some random text" }, 100);
+  ser.value8b(uint64_t{ 6 });
+  ser.value2b(uint16_t{ 7 });
+
+  auto& des = ctx.createDeserializer();
+  uint16_t res{};
+  des.skipValue4b();
+  des.skipText1b(100);
+  des.skipValue<8>();
+  des.value2b(res);
+  EXPECT_THAT(res, Eq(7));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeSkip, SkipContainerOfFundamentalTypes)
+{
+  SerializationContext ctx;
+  std::vector<uint32_t> data{ 1, 2, 3, 4, 5 };
+  auto& ser = ctx.createSerializer();
+  ser.container4b(data, 10);
+  ser.value1b(uint8_t{ 9 });
+
+  auto& des = ctx.createDeserializer();
+  uint8_t res{};
+  des.skipContainer4b(10);
+  des.value1b(res);
+  EXPECT_THAT(res, Eq(9));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeSkip, SkipContainerWithCustomFunction)
+{
+  SerializationContext ctx;
+  std::vector<MyStruct1> data{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+  std::vector<std::string> names{ "a", "bb", "ccc" };
+  auto& ser = ctx.createSerializer();
+  ser.container(data, 10);
+  ser.container(names, 10, [](decltype(ser)& ser, std::string& v) {
+    ser.text1b(v, 10);
+  });
+  ser.object(MyStruct1{ 7, 8 });
+
+  auto& des = ctx.createDeserializer();
+  MyStruct1 res{};
+  size_t skippedCount{};
+  des.skipContainer(10, [&skippedCount](decltype(des)& des) {
+    des.skipValue<MyStruct1::SIZE>();
+    ++skippedCount;
+  });
+  des.skipContainer(10, [](decltype(des)& des) { des.skipText1b(10); });
+  des.object(res);
+  EXPECT_THAT(skippedCount, Eq(3u));
+  EXPECT_THAT(res, Eq(MyStruct1{ 7, 8 }));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeSkip, SkipWhenBitPackingEnabled)
+{
+  SerializationContext ctx;
+  auto& ser = ctx.createSerializer();
+  ser.enableBitPacking([](SerializationContext::TSerializerBPEnabled& sbp) {
+    sbp.adapter().writeBits(uint8_t{ 5 }, 3);
+    sbp.value2b(uint16_t{ 0xFFFF });
+    sbp.value2b(uint16_t{ 0x1234 });
+  });
+
+  auto& des = ctx.createDeserializer();
+  uint8_t bits{};
+  uint16_t res{};
+  des.enableBitPacking(
+    [&bits, &res](SerializationContext::TDeserializerBPEnabled& sbp) {
+      sbp.adapter().readBits(bits, 3);
+      sbp.skipValue2b();
+      sbp.value2b(res);
+    });
+  EXPECT_THAT(bits, Eq(5));
+  EXPECT_THAT(res, Eq(0x1234));
+  EXPECT_THAT(ctx.des->adapter().isCompletedSuccessfully(), Eq(true));
+}
+
+TEST(SerializeSkip, WhenSkippedContainerSizeIsMoreThanMaxSizeThenInvalidData)
+{
+  SerializationContext ctx;
+  std::vector<uint8_t> data{ 1, 2, 3, 4, 5 };
+  ctx.createSerializer().container1b(data, 10);
+
+  auto& des = ctx.createDeserializer();
+  des.skipContainer1b(4);
+  EXPECT_THAT(des.adapter().error(), Eq(bitsery::ReaderError::InvalidData));
+}